@@ -4,6 +4,11 @@
 #include <stack>
 #include <unordered_map>
 #include <climits>
+#include <limits>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
 
 namespace hohlova
 {
@@ -70,6 +75,14 @@ namespace hohlova
 
   long long mod(long long a, long long b)
   {
+    if (b == 0)
+    {
+      throw std::runtime_error("Division by zero\n");
+    }
+    if (b == -1)
+    {
+      return 0;
+    }
     auto res = a % b;
     if (res < 0)
     {
@@ -102,13 +115,15 @@ namespace hohlova
       }
       else if (symbol == ')')
       {
-        char oper = operators.top();
-        while (oper != '(')
+        while (!operators.empty() && operators.top() != '(')
         {
           res.push_back(' ');
-          res.push_back(oper);
+          res.push_back(operators.top());
           operators.pop();
-          oper = operators.top();
+        }
+        if (operators.empty())
+        {
+          throw std::runtime_error("Error!Invalid expression\n");
         }
         operators.pop();
         ++pos;
@@ -127,7 +142,8 @@ namespace hohlova
           {
             throw std::runtime_error("Error!Invalid operand\n");
           }
-          if (priority[oper] >= priority[symbol])
+          auto symbolPriority = priority.find(symbol);
+          if (priority.at(oper) >= (symbolPriority == priority.end() ? 0 : symbolPriority->second))
           {
             res.push_back(' ');
             res.push_back(oper);
@@ -163,22 +179,90 @@ namespace hohlova
     }
   }
 
+  bool ExpressionCalc::CalculateExpression(const std::string& expr, long long& result)
+  {
+    std::string postfix = InfixToPostfix(expr);
+    if (postfix.empty())
+    {
+      return false;
+    }
+    result = Calculate(postfix);
+    return true;
+  }
+
   void ExpressionCalc::CalculateExpressions(Stack< long long >& results)
   {
     while (!expressions.empty())
     {
-      auto& expr = expressions.front();
-      expr = InfixToPostfix(expr);
-      if (expr.empty())
+      long long result = 0;
+      if (CalculateExpression(expressions.front(), result))
       {
-        expressions.pop();
-        continue;
+        results.push(result);
       }
-      results.push(Calculate(expr));
       expressions.pop();
     }
   }
 
+  void ExpressionCalc::CalculateExpressions(Stack< long long >& results, size_t workers)
+  {
+    struct Block
+    {
+      Queue< std::string > expressions;
+      Queue< long long > values;
+      std::exception_ptr error;
+      std::thread worker;
+    };
+    std::unique_ptr< Block[] > blocks(new Block[workers]);
+    size_t count = expressions.size();
+    for (size_t i = 0; i < workers; ++i)
+    {
+      for (size_t j = count * i / workers; j < count * (i + 1) / workers; ++j)
+      {
+        blocks[i].expressions.push(expressions.front());
+        expressions.pop();
+      }
+    }
+    auto calculateBlock = [this](Block& block)
+    {
+      try
+      {
+        while (!block.expressions.empty())
+        {
+          long long result = 0;
+          if (CalculateExpression(block.expressions.front(), result))
+          {
+            block.values.push(result);
+          }
+          block.expressions.pop();
+        }
+      }
+      catch (...)
+      {
+        block.error = std::current_exception();
+      }
+    };
+    for (size_t i = 0; i < workers; ++i)
+    {
+      blocks[i].worker = std::thread(calculateBlock, std::ref(blocks[i]));
+    }
+    for (size_t i = 0; i < workers; ++i)
+    {
+      blocks[i].worker.join();
+    }
+    for (size_t i = 0; i < workers; ++i)
+    {
+      while (!blocks[i].values.empty())
+      {
+        results.push(blocks[i].values.front());
+        blocks[i].values.pop();
+      }
+      if (blocks[i].error)
+      {
+        std::rethrow_exception(blocks[i].error);
+      }
+    }
+  }
+
   long long ExpressionCalc::ParseNum(const std::string& str, size_t& pos)
   {
     auto symbol = static_cast< unsigned char >(str[pos]);
@@ -218,6 +302,10 @@ namespace hohlova
         {
           throw std::runtime_error("Error!Invalid operand\n");
         }
+        if (result.size() < 2)
+        {
+          throw std::runtime_error("Error!Invalid expression\n");
+        }
         auto roperand = result.top();
         result.pop();
         auto loperand = result.top();
@@ -227,6 +315,10 @@ namespace hohlova
         ++pos;
       }
     }
+    if (result.empty())
+    {
+      throw std::runtime_error("Error!Invalid expression\n");
+    }
     return result.top();
   }
 };
@@ -2,6 +2,7 @@
 #define EXPRESSIONCALC_HPP
 #include "queue.hpp"
 #include "stack.hpp"
+#include <istream>
 #include <string>
 
 namespace hohlova
@@ -11,11 +12,13 @@ namespace hohlova
     std::string InfixToPostfix(const std::string& expr);
     long long ParseNum(const std::string& str, size_t& pos);
     long long Calculate(const std::string& postfix);
+    bool CalculateExpression(const std::string& expr, long long& result);
 
   public:
     ExpressionCalc() = default;
     void readExpression(std::istream& input);
     void CalculateExpressions(Stack< long long >&);
+    void CalculateExpressions(Stack< long long >& results, size_t workers);
  private:
    Queue< std::string > expressions;
   };
@@ -1,6 +1,7 @@
 #include "ExpressionCalc.hpp"
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 int main(int argc, char** argv)
 {
@@ -21,7 +22,12 @@ int main(int argc, char** argv)
   }
   try
   {
+#ifdef HOHLOVA_PARALLEL_EVALUATION
+    size_t workers = std::thread::hardware_concurrency();
+    calculator.CalculateExpressions(results, workers == 0 ? 1 : workers);
+#else
     calculator.CalculateExpressions(results);
+#endif
   }
   catch (const std::runtime_error& err)
   {
@@ -115,14 +115,7 @@ namespace hohlova
   template< typename T >
   size_t  Queue< T >::size() const
   {
-    size_t size = 0;
-    typename List< T >::iterator curr = _list.begin();
-    while (curr != _list.end())
-    {
-      ++size;
-      ++curr;
-    }
-    return size;
+    return _list.size();
   }
 
   template< typename T >
@@ -21,34 +21,44 @@ namespace jirkov {
   }
   void printValues(listOfPairs& newList, bool& overflowFlag, List<size_t>& sums)
   {
+    using cursor = List< size_t >::ConstIterator;
+    List< cursor > cursors;
     auto iterator = newList.begin();
+    while (iterator != newList.end())
+    {
+      cursors.pushBack(iterator->second.cbegin());
+      iterator++;
+    }
     const size_t maxSum = std::numeric_limits<size_t>::max();
-    for (size_t i = 0; i < findSize(newList); i++)
+    while (true)
     {
-      iterator = newList.begin();
       size_t sum = 0;
-      while (iterator != newList.end())
+      bool isRowEmpty = true;
+      for (auto argsIt = cursors.begin(); argsIt != cursors.end(); argsIt++)
       {
-        List< size_t >::Iterator argsIt = iterator->second[i];
-        if (iterator->second[i] != nullptr)
+        if (*argsIt == cursor())
+        {
+          continue;
+        }
+        if (!isRowEmpty)
+        {
+          std::cout << " ";
+        }
+        isRowEmpty = false;
+        const size_t value = **argsIt;
+        std::cout << value;
+        if (sum > maxSum - value)
         {
-          if (sum != 0)
-          {
-            std::cout << " ";
-          }
-          std::cout << *argsIt;
-          if (sum > maxSum - *argsIt)
-          {
-            overflowFlag = true;
-            std::cout << "\n";
-            throw std::overflow_error("overflow error");
-          }
-          else
-          {
-            sum += *argsIt;
-          }
+          overflowFlag = true;
+          std::cout << "\n";
+          throw std::overflow_error("overflow error");
         }
-        iterator++;
+        sum += value;
+        ++(*argsIt);
+      }
+      if (isRowEmpty)
+      {
+        break;
       }
       std::cout << "\n";
       sums.pushBack(sum);
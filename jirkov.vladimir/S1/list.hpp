@@ -45,6 +45,7 @@ namespace jirkov
   private:
     details::Node<T>* head_;
     details::Node<T>* tail_;
+    size_t size_;
   };
 }
 
@@ -204,14 +205,14 @@ bool jirkov::List< T >::Iterator::operator==(const Iterator& rhs) const
 template< typename T >
 jirkov::List< T >::List():
   head_(nullptr),
-  tail_(nullptr)
+  tail_(nullptr),
+  size_(0)
 {}
 
 template< typename T >
-jirkov::List< T >::List(size_t n, const T& value)
+jirkov::List< T >::List(size_t n, const T& value):
+  List()
 {
-  head_ = nullptr;
-  tail_ = nullptr;
   for (size_t i = 0; i < n; i++)
   {
     pushBack(value);
@@ -219,10 +220,9 @@ jirkov::List< T >::List(size_t n, const T& value)
 }
 
 template< typename T >
-jirkov::List< T >::List(const List< T >& otherList)
+jirkov::List< T >::List(const List< T >& otherList):
+  List()
 {
-  head_ = nullptr;
-  tail_ = nullptr;
   jirkov::details::Node<T>* head = otherList.head_;
   while (head)
   {
@@ -232,12 +232,10 @@ jirkov::List< T >::List(const List< T >& otherList)
 }
 
 template< typename T >
-jirkov::List< T >::List(List&& otherList)
+jirkov::List< T >::List(List&& otherList):
+  List()
 {
-  head_ = otherList.head_;
-  tail_ = otherList.tail_;
-  otherList.head_ = nullptr;
-  otherList.tail_ = nullptr;
+  swap(otherList);
 }
 
 template< typename T >
@@ -259,6 +257,7 @@ void jirkov::List< T >::pushFront(const T& data)
   {
     head_ = tail_ = node;
   }
+  size_++;
 }
 
 template< typename T >
@@ -282,36 +281,35 @@ void jirkov::List< T >::pushBack(const T& data)
     tail_->next = node;
     tail_ = node;
   }
+  size_++;
 }
 
 template< typename T >
 size_t jirkov::List< T >::getSize()
 {
-  jirkov::details::Node<T>* head = head_;
-  size_t size = 0ull;
-  while (head)
-  {
-    size++;
-    head = head->next;
-  }
-  return size;
+  return size_;
 }
 
 
 template< typename T >
 void jirkov::List< T >::popFront()
 {
+  if (head_ == nullptr)
+  {
+    return;
+  }
   if (head_ == tail_)
   {
     delete tail_;
     head_ = tail_ = nullptr;
   }
-  if (head_ != nullptr)
+  else
   {
     jirkov::details::Node<T>* node = head_;
     head_ = node->next;
     delete node;
   }
+  size_--;
 }
 
 template< typename T >
@@ -334,6 +332,7 @@ void jirkov::List< T >::swap(List< T >& otherList) noexcept
 {
   std::swap(head_, otherList.head_);
   std::swap(tail_, otherList.tail_);
+  std::swap(size_, otherList.size_);
 }
 
 template< typename T >
@@ -342,7 +341,7 @@ void jirkov::List< T >::assign(size_t n, const T& value)
   clear();
   for (size_t i = 0; i < n; i++)
   {
-    push_back(value);
+    pushBack(value);
   }
 }
 
@@ -371,6 +370,7 @@ void jirkov::List< T >::remove(const T& value)
           iterator.node->next = nullptr;
           tail_ = iterator.node;
           delete toRemove;
+          size_--;
         }
         else
         {
@@ -378,6 +378,7 @@ void jirkov::List< T >::remove(const T& value)
           iterator.node->next = nextNode->next;
           nextNode = iterator.node->next;
           delete toRemove;
+          size_--;
         }
       }
       else
@@ -415,6 +416,7 @@ void jirkov::List< T >::removeIf(P p)
           iterator.node->next = nullptr;
           tail_ = iterator.node;
           delete toRemove;
+          size_--;
         }
         else
         {
@@ -422,6 +424,7 @@ void jirkov::List< T >::removeIf(P p)
           iterator.node->next = nextNode->next;
           nextNode = iterator.node->next;
           delete toRemove;
+          size_--;
         }
       }
       else
@@ -448,6 +451,10 @@ T& jirkov::List< T >::back()
 template< typename T >
 typename jirkov::List< T >::ConstIterator jirkov::List< T >::operator[](const int index)
 {
+  if (index < 0 || static_cast< size_t >(index) >= size_)
+  {
+    return nullptr;
+  }
   ConstIterator iterator = cbegin();
   for (int i = 0; i < index; i++)
   {
@@ -481,7 +488,7 @@ typename jirkov::List< T >::ConstIterator jirkov::List< T >::cbegin() const
 template< typename T >
 typename jirkov::List< T >::ConstIterator jirkov::List< T >::cend() const
 {
-  return ConstIterator(tail_->next);
+  return ConstIterator(nullptr);
 }
 
 #endif
@@ -2,6 +2,66 @@
 #include <string>
 #include <iostream>
 #include <cctype>
+#include <functional>
+#include <utility>
+#include "list.hpp"
+
+namespace
+{
+  using dataset_t = khoroshkin::Tree< long long, std::string >;
+
+  dataset_t mergeDatasets(const dataset_t & first, const dataset_t & second,
+    bool withFirstOnly, bool withCommon, bool withSecondOnly)
+  {
+    std::less< long long > comp;
+    khoroshkin::List< std::pair< long long, std::string > > merged;
+    auto firstIt = first.cend();
+    auto secondIt = second.cend();
+    if (!first.isEmpty())
+    {
+      --firstIt;
+    }
+    if (!second.isEmpty())
+    {
+      --secondIt;
+    }
+    while (firstIt != first.cend() || secondIt != second.cend())
+    {
+      long long key = 0;
+      if (secondIt == second.cend() || (firstIt != first.cend() && !comp((*firstIt).first, (*secondIt).first)))
+      {
+        key = (*firstIt).first;
+      }
+      else
+      {
+        key = (*secondIt).first;
+      }
+      bool inFirst = firstIt != first.cend() && !comp((*firstIt).first, key);
+      bool inSecond = secondIt != second.cend() && !comp((*secondIt).first, key);
+      bool takeFirst = inFirst && (inSecond ? withCommon : withFirstOnly);
+      while (firstIt != first.cend() && !comp((*firstIt).first, key))
+      {
+        if (takeFirst)
+        {
+          merged.push_front(*firstIt);
+        }
+        --firstIt;
+      }
+      auto earliest = secondIt;
+      while (secondIt != second.cend() && !comp((*secondIt).first, key))
+      {
+        earliest = secondIt--;
+      }
+      if (inSecond && !inFirst && withSecondOnly)
+      {
+        merged.push_front(*earliest);
+      }
+    }
+    dataset_t result{};
+    result.buildFromSorted(merged.begin(), merged.getSize());
+    return result;
+  }
+}
 
 std::string khoroshkin::getString(std::string & line, size_t & pos)
 {
@@ -64,15 +124,7 @@ void khoroshkin::complement(khoroshkin::Tree< std::string, khoroshkin::Tree< lon
     outInvalid(std::cout);
     return;
   }
-  khoroshkin::Tree< long long, std::string > datasets{};
-  for (auto it = (*firstData).second.begin(); it != (*firstData).second.end(); it++)
-  {
-    auto inSecondData = (*Tree.find(nameSecond)).second.find((*it).first);
-    if (inSecondData == (*Tree.find(nameSecond)).second.end())
-    {
-      datasets.insert(*it);
-    }
-  }
+  dataset_t datasets = mergeDatasets((*firstData).second, (*secondData).second, true, false, false);
   if (nameFirst == name)
   {
     Tree.erase(nameFirst);
@@ -96,15 +148,7 @@ void khoroshkin::intersect(khoroshkin::Tree< std::string, khoroshkin::Tree< long
     outInvalid(std::cout);
     return;
   }
-  khoroshkin::Tree< long long, std::string > datasets{};
-  for (auto it = (*firstData).second.begin(); it != (*firstData).second.end(); it++)
-  {
-    auto inSecondData = (*Tree.find(nameSecond)).second.find((*it).first);
-    if (inSecondData != (*Tree.find(nameSecond)).second.end())
-    {
-      datasets.insert(*it);
-    }
-  }
+  dataset_t datasets = mergeDatasets((*firstData).second, (*secondData).second, false, true, false);
   if (nameFirst == name)
   {
     Tree.erase(nameFirst);
@@ -128,19 +172,7 @@ void khoroshkin::unite(khoroshkin::Tree< std::string, khoroshkin::Tree< long lon
     outInvalid(std::cout);
     return;
   }
-  khoroshkin::Tree< long long, std::string > datasets{};
-  for (auto it = (*firstData).second.begin(); it != (*firstData).second.end(); it++)
-  {
-    datasets.insert(*it);
-  }
-  for (auto it = (*secondData).second.begin(); it != (*secondData).second.end(); it++)
-  {
-    auto inSet = datasets.find((*it).first);
-    if (inSet == datasets.end())
-    {
-      datasets.insert(*it);
-    }
-  }
+  dataset_t datasets = mergeDatasets((*firstData).second, (*secondData).second, true, true, true);
   if (nameFirst == name)
   {
     Tree.erase(nameFirst);
@@ -1,6 +1,7 @@
 #ifndef BINARYSEARCHTREE_HPP
 #define BINARYSEARCHTREE_HPP
 
+#include <algorithm>
 #include <functional>
 #include <utility>
 #include <iterator>
@@ -40,6 +41,8 @@ namespace khoroshkin
     iterator find(const Key & key);
     Value & operator[](const Key & key);
     void clear();
+    template< class InputIt >
+    void buildFromSorted(InputIt first, size_t count);
 
     bool isEmpty() const noexcept;
     size_t getSize() const noexcept;
@@ -63,6 +66,8 @@ namespace khoroshkin
     Node * insert(Key k, Value v, Node * node, Node * prev);
     iterator find(const Key & key, Node * node);
     void clear(Node * node);
+    template< class InputIt >
+    Node * buildSubtree(InputIt & first, size_t count);
 
     int getHeight(Node * node);
     size_t updateHeight(Node * node);
@@ -715,6 +720,52 @@ void khoroshkin::Tree< Key, Value, Comp >::clear()
   clear(root);
 }
 
+template< typename Key, typename Value, typename Comp >
+template< class InputIt >
+void khoroshkin::Tree< Key, Value, Comp >::buildFromSorted(InputIt first, size_t count)
+{
+  Node * newRoot = buildSubtree(first, count);
+  clear(root);
+  root = newRoot;
+  size = count;
+}
+
+template< typename Key, typename Value, typename Comp >
+template< class InputIt >
+typename khoroshkin::Tree< Key, Value, Comp >::Node * khoroshkin::Tree< Key, Value, Comp >::buildSubtree(InputIt & first, size_t count)
+{
+  if (count == 0)
+  {
+    return nullptr;
+  }
+  Node * left = buildSubtree(first, count / 2);
+  Node * node = nullptr;
+  Node * right = nullptr;
+  try
+  {
+    node = new Node((*first).first, (*first).second, nullptr, 1, left);
+    ++first;
+    right = buildSubtree(first, count - count / 2 - 1);
+  }
+  catch (...)
+  {
+    clear(left);
+    delete node;
+    throw;
+  }
+  node->right = right;
+  if (left)
+  {
+    left->parent = node;
+  }
+  if (right)
+  {
+    right->parent = node;
+  }
+  node->height = std::max(getHeight(left), getHeight(right)) + 1;
+  return node;
+}
+
 template< typename Key, typename Value, typename Comp >
 bool khoroshkin::Tree< Key, Value, Comp >::isEmpty() const noexcept
 {
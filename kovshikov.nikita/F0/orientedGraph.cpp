@@ -72,17 +72,17 @@ void kovshikov::Graph::getConnectKeys(DoubleList< size_t >& connectKeys, size_t
    std::copy_if(keys.begin(), keys.end(), std::back_inserter(connectKeys), std::bind(noThis, whoKey, std::placeholders::_1));
 }
 
-std::string kovshikov::Graph::getVertex(std::pair< size_t, Node > vertex)
+std::string kovshikov::Graph::getVertex(const std::pair< size_t, Node >& vertex)
 {
   return vertex.second.value;
 }
 
-size_t kovshikov::Graph::getCountEdge(std::pair< size_t, Node > vertex)
+size_t kovshikov::Graph::getCountEdge(const std::pair< size_t, Node >& vertex)
 {
   return vertex.second.edges.size();
 }
 
-size_t kovshikov::getKey(std::pair< size_t, Graph::Node > vertex)
+size_t kovshikov::getKey(const std::pair< size_t, Graph::Node >& vertex)
 {
   return vertex.first;
 }
@@ -391,7 +391,7 @@ size_t kovshikov::Graph::getSize() const noexcept
   return tree.size();
 }
 
-bool kovshikov::Graph::comp(std::pair< size_t, Node > left, std::pair< size_t, Node > right, Graph& graph)
+bool kovshikov::Graph::comp(const std::pair< size_t, Node >& left, const std::pair< size_t, Node >& right, Graph& graph)
 {
   return graph.getDegree(left.first) > graph.getDegree(right.first);
 }
@@ -400,7 +400,7 @@ void kovshikov::Graph::getMax(std::ostream& out)
   using namespace std::placeholders;
   DoubleList< std::pair< size_t, Node > > tempVector;
   std::copy(tree.begin(), tree.end(), std::back_inserter(tempVector));
-  selectionSort(tempVector.begin(), tempVector.end(), std::bind(comp, _1, _2, *this));
+  selectionSort(tempVector.begin(), tempVector.end(), std::bind(comp, _1, _2, std::ref(*this)));
   size_t max = tempVector.front().first;
   DoubleList< size_t > keys;
   std::transform(tree.begin(), tree.end(), std::back_inserter(keys), getKey);
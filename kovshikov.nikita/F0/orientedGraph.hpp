@@ -41,8 +41,8 @@ namespace kovshikov
     bool isDouble(size_t key1, size_t key2);
 
     void getConnectKeys(DoubleList< size_t >& connectKeys, size_t whoKey);
-    std::string getVertex(std::pair< size_t, Node > vertex);
-    static size_t getCountEdge(std::pair< size_t, Node > vertex);
+    std::string getVertex(const std::pair< size_t, Node >& vertex);
+    static size_t getCountEdge(const std::pair< size_t, Node >& vertex);
 
     void outGraph(std::ostream& out) const;
 
@@ -50,7 +50,7 @@ namespace kovshikov
     bool isEmpty() const noexcept;
     size_t getSize() const noexcept;
 
-    static bool comp(std::pair< size_t, Node > left, std::pair< size_t, Node > right, Graph& graph);
+    static bool comp(const std::pair< size_t, Node >& left, const std::pair< size_t, Node >& right, Graph& graph);
 
   private:
     Tree< size_t, Node > tree;
@@ -58,7 +58,7 @@ namespace kovshikov
 
   bool noThis(size_t whoKey, size_t randomKey);
 
-  size_t getKey(std::pair< size_t, Graph::Node > vertex);
+  size_t getKey(const std::pair< size_t, Graph::Node >& vertex);
   size_t getWith(std::pair< size_t, size_t > edge);
   size_t getWeightEdge(std::pair< size_t, size_t > edge);
 }
@@ -1,47 +1,68 @@
+#include <atomic>
 #include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <thread>
 #include "computing.hpp"
 
-void kovshikov::readData(std::istream& in, Queue< std::string >& allData)
+void kovshikov::readData(std::istream& in, std::string& allData)
 {
-  while(!in.eof())
+  allData.assign(std::istreambuf_iterator< char >(in), std::istreambuf_iterator< char >());
+}
+
+kovshikov::Token kovshikov::getToken(const std::string& text, size_t offset, size_t length)
+{
+  if(isDigit(text, offset, length))
   {
-    std::string expression = "";
-    std::getline(in, expression);
-    if(!expression.empty())
-    {
-      allData.push(expression);
-    }
+    return {TokenKind::OPERAND, '\0', offset, length};
   }
+  char symbol = text[offset];
+  if(symbol == '(')
+  {
+    return {TokenKind::OPEN_BRACKET, symbol, offset, length};
+  }
+  else if(symbol == ')')
+  {
+    return {TokenKind::CLOSE_BRACKET, symbol, offset, length};
+  }
+  return {TokenKind::OPERATION, symbol, offset, length};
 }
 
-void kovshikov::separateElements(std::string str, Queue< std::string >& queue)
+void kovshikov::separateElements(const std::string& text, size_t begin, size_t end, tokenQueue< Token >& queue)
 {
-  std::string temp = "";
-  size_t sizeStr = str.length();
-  for(size_t i = 0; i < sizeStr; i++)
+  size_t start = begin;
+  for(size_t i = begin; i < end; i++)
   {
-    if(str[i] != ' ')
+    if(text[i] == ' ')
     {
-      temp += str[i];
-    }
-    else
-    {
-      queue.push(temp);
-      temp = "";
+      queue.push(getToken(text, start, i - start));
+      start = i + 1;
     }
   }
-  queue.push(temp);
+  queue.push(getToken(text, start, end - start));
 }
 
-void kovshikov::separateElements(Queue< std::string > oldQ, doubleQ& sepQ)
+void kovshikov::separateElements(const std::string& text, doubleQ& sepQ)
 {
-  size_t size = oldQ.getSize();
-  for(size_t i = 0; i < size; i++)
+  size_t size = text.length();
+  size_t begin = 0;
+  while(begin < size)
   {
-    Queue< std::string > queue;
-    separateElements(oldQ.front(), queue);
-    oldQ.pop();
-    sepQ.push(queue);
+    size_t end = text.find('\n', begin);
+    if(end == std::string::npos)
+    {
+      end = size;
+    }
+    if(end != begin)
+    {
+      tokenQueue< Token > queue;
+      separateElements(text, begin, end, queue);
+      sepQ.push(queue);
+    }
+    begin = end + 1;
   }
 }
 
@@ -61,12 +82,11 @@ int kovshikov::getPriority(char c)
   }
 }
 
-bool kovshikov::isDigit(std::string str)
+bool kovshikov::isDigit(const std::string& text, size_t offset, size_t length)
 {
-  size_t size = str.length();
-  for(size_t i = 0; i < size; i++)
+  for(size_t i = offset; i < offset + length; i++)
   {
-    if(!std::isdigit(str[i]))
+    if(!std::isdigit(text[i]))
     {
       return false;
     }
@@ -74,38 +94,117 @@ bool kovshikov::isDigit(std::string str)
   return true;
 }
 
-void kovshikov::getPostfix(Queue< std::string >& oldQ, Queue< std::string >& newQ)
+long long kovshikov::getOperand(const std::string& text, const Token& token)
+{
+  if(token.length == 0)
+  {
+    throw std::invalid_argument("Empty operand");
+  }
+  long long max = std::numeric_limits< long long >::max();
+  long long integer = 0;
+  for(size_t i = token.offset; i < token.offset + token.length; i++)
+  {
+    long long digit = text[i] - '0';
+    if(integer > (max - digit) / 10)
+    {
+      throw std::out_of_range("You've gone out of range long long");
+    }
+    integer = integer * 10 + digit;
+  }
+  return integer;
+}
+
+long long kovshikov::calculate(char operation, long long operand, long long upperOperand)
+{
+  long long min = std::numeric_limits< long long >::min();
+  long long max = std::numeric_limits< long long >::max();
+  if(operation == '+')
+  {
+    long long summa = operand + upperOperand;
+    if(operand > 0 && upperOperand > 0 && summa < 0 )
+    {
+      throw std::overflow_error("overflow after summa");
+    }
+    return summa;
+  }
+  else if(operation == '-')
+  {
+    return operand - upperOperand;
+  }
+  else if(operation == '*')
+  {
+    if(operand == 0 || upperOperand == 0)
+    {
+      return 0;
+    }
+    bool condOperand = operand > max / std::abs(upperOperand) || operand < min / std::abs(upperOperand);
+    bool condUOperand = upperOperand > max / std::abs(operand) || upperOperand < min / std::abs(operand);
+    if(condOperand || condUOperand)
+    {
+      throw std::range_error("range violation during multiplication");
+    }
+    return operand * upperOperand;
+  }
+  else if(upperOperand == 0)
+  {
+    throw std::domain_error("division by zero");
+  }
+  else if(operand == min && upperOperand == -1)
+  {
+    throw std::overflow_error("overflow after division");
+  }
+  else if(operation == '/')
+  {
+    return operand / upperOperand;
+  }
+  else if(operand > 0)
+  {
+    return operand % upperOperand;
+  }
+  else
+  {
+    long long part = std::abs(operand / upperOperand);
+    part++;
+    long long temp = part * upperOperand;
+    return operand + temp;
+  }
+}
+
+void kovshikov::getPostfix(tokenQueue< Token >& oldQ, tokenQueue< Token >& newQ)
 {
   bool isCorrect = true;
-  Stack< std::string > stack;
-  std::string element = "";
+  tokenStack< Token > stack;
   size_t size = oldQ.getSize();
   for(size_t i = 0; i < size; i++)
   {
-    element = oldQ.front();
+    Token element = oldQ.front();
     oldQ.pop();
-    if(isDigit(element))
+    if(element.kind == TokenKind::OPERAND)
     {
       newQ.push(element);
     }
-    else if(element[0] == '(')
+    else if(element.kind == TokenKind::OPEN_BRACKET)
     {
       isCorrect = false;
       stack.push(element);
     }
-    else if(element[0] == ')')
+    else if(element.kind == TokenKind::CLOSE_BRACKET)
     {
       isCorrect = true;
-      while(stack.top()[0] != '(')
+      while(!stack.isEmpty() && stack.top().kind != TokenKind::OPEN_BRACKET)
       {
         newQ.push(stack.top());
         stack.pop();
       }
+      if(stack.isEmpty())
+      {
+        throw std::domain_error("A single closing bracket");
+      }
       stack.pop();
     }
     else
     {
-      while(!stack.isEmpty() && getPriority(element[0]) <= getPriority(stack.top()[0]))
+      while(!stack.isEmpty() && getPriority(element.symbol) <= getPriority(stack.top().symbol))
       {
         newQ.push(stack.top());
         stack.pop();
@@ -124,128 +223,224 @@ void kovshikov::getPostfix(Queue< std::string >& oldQ, Queue< std::string >& new
   }
 }
 
-void kovshikov::getPostfix(doubleQ oldQ, doubleQ& newQ)
+void kovshikov::getPostfix(doubleQ& oldQ, doubleQ& newQ)
 {
   size_t size = oldQ.getSize();
   for(size_t i = 0; i < size; i++)
   {
-    Queue< std::string > queue;
-    try
-    {
-      getPostfix(oldQ.front(), queue);
-    }
-    catch(const std::exception &error)
-    {
-      throw;
-    }
+    tokenQueue< Token > queue;
+    getPostfix(oldQ.front(), queue);
     oldQ.pop();
     newQ.push(queue);
   }
 }
 
-long long kovshikov::getComputation(Queue< std::string > queue)
+long long kovshikov::getComputation(const std::string& text, tokenQueue< Token >& queue)
 {
-  long long min = std::numeric_limits< long long >::min();
-  long long max = std::numeric_limits< long long >::max();
-  Stack< long long > stack;
+  tokenStack< long long > stack;
   size_t size = queue.getSize();
   for(size_t i = 0; i < size; i++)
   {
-    std::string element = queue.front();
+    Token element = queue.front();
     queue.pop();
-    if(isDigit(element))
+    if(element.kind == TokenKind::OPERAND)
     {
-      long long integer = std::stoll(element);
-      if(integer == min)
-      {
-        throw std::underflow_error("You've gone out of range long long от -9223372036854775808");
-      }
-      stack.push(integer);
+      stack.push(getOperand(text, element));
     }
     else
     {
-      long long upperOperand = stack.top();
-      stack.pop();
-      long long operand = stack.top();
-      stack.pop();
-      if(element == "+")
+      applyOperation(stack, element.symbol);
+    }
+  }
+  if(stack.isEmpty())
+  {
+    throw std::invalid_argument("Empty operand");
+  }
+  return stack.top();
+}
+
+void kovshikov::getComputation(const std::string& text, doubleQ& data, tokenStack< long long >& result)
+{
+  size_t size = data.getSize();
+  for(size_t i = 0; i < size; i++)
+  {
+    long long outcome = getComputation(text, data.front());
+    data.pop();
+    result.push(outcome);
+  }
+}
+
+void kovshikov::applyOperation(tokenStack< long long >& values, char operation)
+{
+  if(values.getSize() < 2)
+  {
+    throw std::invalid_argument("Not enough operands");
+  }
+  long long upperOperand = values.top();
+  values.pop();
+  long long operand = values.top();
+  values.pop();
+  if(getPriority(operation) != 0)
+  {
+    values.push(calculate(operation, operand, upperOperand));
+  }
+}
+
+long long kovshikov::evaluate(const std::string& line)
+{
+  bool isCorrect = true;
+  tokenStack< char > operations;
+  tokenStack< long long > values;
+  size_t size = line.length();
+  size_t start = 0;
+  for(size_t i = 0; i <= size; i++)
+  {
+    if(i != size && line[i] != ' ')
+    {
+      continue;
+    }
+    Token element = getToken(line, start, i - start);
+    start = i + 1;
+    if(element.kind == TokenKind::OPERAND)
+    {
+      values.push(getOperand(line, element));
+    }
+    else if(element.kind == TokenKind::OPEN_BRACKET)
+    {
+      isCorrect = false;
+      operations.push(element.symbol);
+    }
+    else if(element.kind == TokenKind::CLOSE_BRACKET)
+    {
+      isCorrect = true;
+      while(!operations.isEmpty() && operations.top() != '(')
       {
-        long long summa = operand + upperOperand;
-        if(operand > 0 && upperOperand > 0 && summa < 0 )
-        {
-          throw std::overflow_error("overflow after summa");
-        }
-        stack.push(summa);
+        applyOperation(values, operations.top());
+        operations.pop();
       }
-      else if(element == "-")
+      if(operations.isEmpty())
       {
-        stack.push(operand - upperOperand);
+        throw std::domain_error("A single closing bracket");
       }
-      else if(element == "*")
+      operations.pop();
+    }
+    else
+    {
+      while(!operations.isEmpty() && getPriority(element.symbol) <= getPriority(operations.top()))
       {
-        bool condOperand = operand > max / std::abs(upperOperand) || operand < min / std::abs(upperOperand);
-        bool condUOperand = upperOperand > max / std::abs(operand) || upperOperand < min / std::abs(operand);
-        if(condOperand || condUOperand)
-        {
-          throw std::range_error("range violation during multiplication");
-        }
-        stack.push(operand * upperOperand);
+        applyOperation(values, operations.top());
+        operations.pop();
       }
-      else if(element == "/")
+      operations.push(element.symbol);
+    }
+  }
+  if(isCorrect == false)
+  {
+    throw std::domain_error("A single opening bracket");
+  }
+  while(!operations.isEmpty())
+  {
+    applyOperation(values, operations.top());
+    operations.pop();
+  }
+  if(values.isEmpty())
+  {
+    throw std::invalid_argument("Empty operand");
+  }
+  return values.top();
+}
+
+void kovshikov::evaluateLines(std::istream& in, tokenStack< long long >& result)
+{
+  std::string line = "";
+  while(std::getline(in, line))
+  {
+    if(!line.empty())
+    {
+      result.push(evaluate(line));
+    }
+  }
+}
+
+namespace
+{
+  struct Worker
+  {
+    kovshikov::tokenQueue< std::string > lines;
+    kovshikov::tokenQueue< long long > values;
+    std::exception_ptr error;
+  };
+
+  void evaluateQueue(Worker& worker, std::atomic< bool >& isFailed)
+  {
+    while(!worker.lines.isEmpty() && !isFailed)
+    {
+      try
       {
-        stack.push(operand / upperOperand);
+        worker.values.push(kovshikov::evaluate(worker.lines.front()));
       }
-      else if(element == "%")
+      catch(...)
       {
-        if(operand > 0)
-        {
-          stack.push(operand % upperOperand);
-        }
-        else
-        {
-          long long part = std::abs(operand / upperOperand);
-          part++;
-          long long temp = part * upperOperand;
-          stack.push(operand + temp);
-        }
+        worker.error = std::current_exception();
+        isFailed = true;
+        return;
       }
+      worker.lines.pop();
     }
   }
-  return stack.top();
 }
 
-void kovshikov::getComputation(doubleQ data, Stack< long long >& result)
+void kovshikov::evaluateLines(std::istream& in, tokenStack< long long >& result, size_t workers)
 {
-  long long outcome;
-  size_t size = data.getSize();
-  for(size_t i = 0; i < size; i++)
+  std::unique_ptr< Worker[] > team(new Worker[workers]);
+  size_t count = 0;
+  std::string line = "";
+  while(std::getline(in, line))
   {
-    Queue< std::string > temp = data.front();
-    data.pop();
-    try
+    if(!line.empty())
+    {
+      team[count % workers].lines.push(line);
+      count += 1;
+    }
+  }
+  std::atomic< bool > isFailed(false);
+  std::unique_ptr< std::thread[] > pool(new std::thread[workers]);
+  for(size_t i = 0; i < workers; i++)
+  {
+    pool[i] = std::thread(evaluateQueue, std::ref(team[i]), std::ref(isFailed));
+  }
+  for(size_t i = 0; i < workers; i++)
+  {
+    pool[i].join();
+  }
+  for(size_t i = 0; i < count; i++)
+  {
+    Worker& worker = team[i % workers];
+    if(!worker.values.isEmpty())
     {
-      outcome = getComputation(temp);
+      result.push(worker.values.front());
+      worker.values.pop();
+      continue;
     }
-    catch(const std::exception &error)
+    if(worker.error)
     {
-      throw;
+      std::rethrow_exception(worker.error);
     }
-    result.push(outcome);
+    result.push(evaluate(worker.lines.front()));
+    worker.lines.pop();
   }
 }
 
-void kovshikov::output(std::ostream& out, Stack< long long > result)
+void kovshikov::output(std::ostream& out, tokenStack< long long >& result)
 {
   size_t size = result.getSize();
   for(size_t i = 0; i < size; i++)
   {
-    if(i == size - 1)
+    if(i != 0)
     {
-      out << result.top();
-      result.pop();
+      out << " ";
     }
-    else
-    out << result.top() << " ";
+    out << result.top();
     result.pop();
   }
   out << "\n";
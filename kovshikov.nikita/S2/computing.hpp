@@ -2,22 +2,65 @@
 #define COMPUTING_HPP
 #include <cmath>
 #include <exception>
+#include <iostream>
+#include <limits>
+#include <string>
+#ifdef KOVSHIKOV_CONTIGUOUS_CONTAINERS
+#include "ringQueue.hpp"
+#include "vectorStack.hpp"
+#else
 #include "queue.hpp"
 #include "stack.hpp"
+#endif
 
 namespace kovshikov
 {
-  using doubleQ = Queue< Queue< std::string > >;
-  void readData(std::istream& in, Queue< std::string >& allData);
-  void separateElements(std::string str, Queue< std::string >& queue);
-  void separateElements(Queue< std::string > oldQ, doubleQ& sepQ);
+#ifdef KOVSHIKOV_CONTIGUOUS_CONTAINERS
+  template< typename T >
+  using tokenQueue = RingQueue< T >;
+  template< typename T >
+  using tokenStack = VectorStack< T >;
+#else
+  template< typename T >
+  using tokenQueue = Queue< T >;
+  template< typename T >
+  using tokenStack = Stack< T >;
+#endif
+
+  enum class TokenKind
+  {
+    OPERAND,
+    OPERATION,
+    OPEN_BRACKET,
+    CLOSE_BRACKET
+  };
+
+  struct Token
+  {
+    TokenKind kind;
+    char symbol;
+    size_t offset;
+    size_t length;
+  };
+
+  using doubleQ = tokenQueue< tokenQueue< Token > >;
+  void readData(std::istream& in, std::string& allData);
+  Token getToken(const std::string& text, size_t offset, size_t length);
+  void separateElements(const std::string& text, size_t begin, size_t end, tokenQueue< Token >& queue);
+  void separateElements(const std::string& text, doubleQ& sepQ);
   int getPriority(char c);
-  bool isDigit(std::string str);
-  void getPostfix(Queue< std::string >& oldQ, Queue< std::string >& newQ);
-  void getPostfix(doubleQ oldQ, doubleQ& newQ);
-  long long getComputation(Queue< std::string > queue);
-  void getComputation(doubleQ data, Stack< long long >& result);
-  void output(std::ostream& out, Stack< long long > result);
+  bool isDigit(const std::string& text, size_t offset, size_t length);
+  long long getOperand(const std::string& text, const Token& token);
+  long long calculate(char operation, long long operand, long long upperOperand);
+  void applyOperation(tokenStack< long long >& values, char operation);
+  void getPostfix(tokenQueue< Token >& oldQ, tokenQueue< Token >& newQ);
+  void getPostfix(doubleQ& oldQ, doubleQ& newQ);
+  long long getComputation(const std::string& text, tokenQueue< Token >& queue);
+  void getComputation(const std::string& text, doubleQ& data, tokenStack< long long >& result);
+  long long evaluate(const std::string& line);
+  void evaluateLines(std::istream& in, tokenStack< long long >& result);
+  void evaluateLines(std::istream& in, tokenStack< long long >& result, size_t workers);
+  void output(std::ostream& out, tokenStack< long long >& result);
 }
 
 #endif
@@ -1,40 +1,60 @@
 #include <cstring>
 #include <fstream>
+#include <thread>
 #include "computing.hpp"
-#include "queue.hpp"
-#include "stack.hpp"
 
 int main(int argc, char ** argv)
 {
   using namespace kovshikov;
-  Queue< std::string > allData;
-  doubleQ separateData;
-  doubleQ postfixQ;
-  Stack< long long > result;
-  if(argc == 1)
+  std::ifstream file;
+  if(argc == 2)
   {
-    readData(std::cin, allData);
+    file.open(argv[1]);
   }
-  else if(argc == 2)
+  else if(argc != 1)
   {
-    std::ifstream file(argv[1]);
-    readData(file, allData);
+    std::cout << "Something went wrong." << "\n";
   }
-  else
+  std::istream& in = (argc == 2) ? file : std::cin;
+  tokenStack< long long > result;
+#if defined(KOVSHIKOV_FUSED_EVALUATION) || defined(KOVSHIKOV_PARALLEL_EVALUATION)
+  try
   {
-    std::cout << "Something went wrong." << "\n";
+    if(argc <= 2)
+    {
+#ifdef KOVSHIKOV_PARALLEL_EVALUATION
+      size_t workers = std::thread::hardware_concurrency();
+      evaluateLines(in, result, workers == 0 ? 1 : workers);
+#else
+      evaluateLines(in, result);
+#endif
+    }
+  }
+  catch(const std::exception &error)
+  {
+    std::cerr << error.what() << "\n";
+    return 1;
+  }
+#else
+  std::string allData;
+  doubleQ separateData;
+  doubleQ postfixQ;
+  if(argc <= 2)
+  {
+    readData(in, allData);
   }
   separateElements(allData, separateData);
   try
   {
     getPostfix(separateData, postfixQ);
-    getComputation(postfixQ, result);
+    getComputation(allData, postfixQ, result);
   }
   catch(const std::exception &error)
   {
     std::cerr << error.what() << "\n";
     return 1;
   }
+#endif
   output(std::cout, result);
   return 0;
 }
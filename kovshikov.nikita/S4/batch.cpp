@@ -0,0 +1,271 @@
+#include "batch.hpp"
+#include <condition_variable>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+  const size_t noWriter = std::numeric_limits< size_t >::max();
+
+  bool findSlot(const kovshikov::Script& script, const std::string& name, size_t& slot)
+  {
+    auto iterator = script.current.find(name);
+    if(iterator == script.current.end())
+    {
+      return false;
+    }
+    slot = iterator -> second;
+    return true;
+  }
+
+  void addInvalid(std::istream& in, kovshikov::Script& script)
+  {
+    script.commands.push_back({kovshikov::Opcode::INVALID, "", 0, 0, 0});
+    in.clear();
+    in.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+  }
+
+  void runCommand(std::ostream& out, kovshikov::Script& script, const kovshikov::Command& command)
+  {
+    using namespace kovshikov;
+    std::vector< Dictionary >& slots = script.slots;
+    switch(command.opcode)
+    {
+    case Opcode::PRINT:
+      printDictionary(out, command.name, slots[command.first]);
+      break;
+    case Opcode::COMPLEMENT:
+      slots[command.target] = complement(slots[command.first], slots[command.second]);
+      break;
+    case Opcode::INTERSECT:
+      slots[command.target] = intersect(slots[command.first], slots[command.second]);
+      break;
+    case Opcode::UNION:
+      slots[command.target] = unite(slots[command.first], slots[command.second]);
+      break;
+    case Opcode::INVALID:
+      outText(out, "<INVALID COMMAND>");
+      break;
+    }
+  }
+}
+
+void kovshikov::readScript(std::istream& in, const Registry& allTree, Script& script)
+{
+  for(auto iterator = allTree.cbegin(); iterator != allTree.cend(); ++iterator)
+  {
+    script.current[iterator -> first] = script.slots.size();
+    script.slots.push_back(iterator -> second);
+    script.writers.push_back(noWriter);
+  }
+  Tree< std::string, Opcode > opcodes;
+  opcodes.insert("print", Opcode::PRINT);
+  opcodes.insert("complement", Opcode::COMPLEMENT);
+  opcodes.insert("intersect", Opcode::INTERSECT);
+  opcodes.insert("union", Opcode::UNION);
+  std::string word;
+  while(in >> word)
+  {
+    auto opcode = opcodes.find(word);
+    if(opcode == opcodes.end())
+    {
+      addInvalid(in, script);
+      continue;
+    }
+    Command command = {opcode -> second, "", 0, 0, 0};
+    if(command.opcode == Opcode::PRINT)
+    {
+      in >> command.name;
+      if(!findSlot(script, command.name, command.first))
+      {
+        addInvalid(in, script);
+        continue;
+      }
+    }
+    else
+    {
+      std::string nameFirst;
+      std::string nameSecond;
+      in >> command.name >> nameFirst >> nameSecond;
+      if(!findSlot(script, nameFirst, command.first) || !findSlot(script, nameSecond, command.second))
+      {
+        addInvalid(in, script);
+        continue;
+      }
+      command.target = script.slots.size();
+      script.slots.emplace_back();
+      script.writers.push_back(script.commands.size());
+      script.current[command.name] = command.target;
+    }
+    script.commands.push_back(command);
+  }
+}
+
+void kovshikov::executeScript(std::ostream& out, Script& script, size_t workers)
+{
+  const std::vector< Command >& commands = script.commands;
+  size_t size = commands.size();
+  std::vector< std::string > outputs(size);
+  std::vector< std::exception_ptr > errors(size);
+  std::vector< bool > isDone(size, false);
+  std::vector< size_t > pending(size, 0);
+  std::vector< std::vector< size_t > > dependents(size);
+  std::vector< size_t > readers(script.slots.size(), 0);
+  std::vector< bool > isFinal(script.slots.size(), false);
+  for(auto iterator = script.current.cbegin(); iterator != script.current.cend(); ++iterator)
+  {
+    isFinal[iterator -> second] = true;
+  }
+  std::queue< size_t > ready;
+  size_t remaining = 0;
+  for(size_t i = 0; i < size; i++)
+  {
+    const Command& command = commands[i];
+    if(command.opcode == Opcode::INVALID)
+    {
+      isDone[i] = true;
+      continue;
+    }
+    remaining++;
+    size_t reads[] = {command.first, command.second};
+    size_t readCount = (command.opcode == Opcode::PRINT || command.first == command.second) ? 1 : 2;
+    for(size_t j = 0; j < readCount; j++)
+    {
+      readers[reads[j]]++;
+      size_t writer = script.writers[reads[j]];
+      if(writer != noWriter)
+      {
+        pending[i]++;
+        dependents[writer].push_back(i);
+      }
+    }
+    if(pending[i] == 0)
+    {
+      ready.push(i);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable finished;
+  auto work = [&]()
+  {
+    std::unique_lock< std::mutex > lock(mutex);
+    while(true)
+    {
+      wake.wait(lock, [&]()
+      {
+        return !ready.empty() || remaining == 0;
+      });
+      if(ready.empty())
+      {
+        return;
+      }
+      size_t index = ready.front();
+      ready.pop();
+      lock.unlock();
+      const Command& command = commands[index];
+      try
+      {
+        std::ostringstream stream;
+        runCommand(stream, script, command);
+        outputs[index] = stream.str();
+      }
+      catch(...)
+      {
+        errors[index] = std::current_exception();
+      }
+      std::vector< size_t > released;
+      lock.lock();
+      size_t reads[] = {command.first, command.second};
+      size_t readCount = (command.opcode == Opcode::PRINT || command.first == command.second) ? 1 : 2;
+      for(size_t j = 0; j < readCount; j++)
+      {
+        if(--readers[reads[j]] == 0 && !isFinal[reads[j]])
+        {
+          released.push_back(reads[j]);
+        }
+      }
+      if(command.opcode != Opcode::PRINT && readers[command.target] == 0 && !isFinal[command.target])
+      {
+        released.push_back(command.target);
+      }
+      for(size_t dependent: dependents[index])
+      {
+        if(--pending[dependent] == 0)
+        {
+          ready.push(dependent);
+        }
+      }
+      isDone[index] = true;
+      remaining--;
+      wake.notify_all();
+      finished.notify_all();
+      lock.unlock();
+      for(size_t slot: released)
+      {
+        script.slots[slot] = Dictionary();
+      }
+      lock.lock();
+    }
+  };
+
+  std::vector< std::thread > pool;
+  pool.reserve(workers);
+  for(size_t i = 0; i < workers; i++)
+  {
+    pool.emplace_back(work);
+  }
+  std::exception_ptr error = nullptr;
+  for(size_t i = 0; i < size && !error; i++)
+  {
+    std::unique_lock< std::mutex > lock(mutex);
+    finished.wait(lock, [&]()
+    {
+      return isDone[i];
+    });
+    lock.unlock();
+    if(errors[i])
+    {
+      error = errors[i];
+    }
+    else if(commands[i].opcode == Opcode::INVALID)
+    {
+      outText(out, "<INVALID COMMAND>");
+    }
+    else
+    {
+      out << outputs[i];
+      std::string().swap(outputs[i]);
+    }
+  }
+  for(size_t i = 0; i < workers; i++)
+  {
+    pool[i].join();
+  }
+  if(error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+void kovshikov::saveScript(Registry& allTree, Script& script)
+{
+  for(auto iterator = script.current.cbegin(); iterator != script.current.cend(); ++iterator)
+  {
+    allTree[iterator -> first] = script.slots[iterator -> second];
+  }
+}
+
+void kovshikov::executeBatch(std::istream& in, std::ostream& out, Registry& allTree, size_t workers)
+{
+  Script script;
+  readScript(in, allTree, script);
+  executeScript(out, script, workers == 0 ? 1 : workers);
+  saveScript(allTree, script);
+}
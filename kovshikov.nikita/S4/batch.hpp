@@ -0,0 +1,43 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "treeProcess.hpp"
+
+namespace kovshikov
+{
+  enum class Opcode
+  {
+    PRINT,
+    COMPLEMENT,
+    INTERSECT,
+    UNION,
+    INVALID
+  };
+
+  struct Command
+  {
+    Opcode opcode;
+    std::string name;
+    size_t target;
+    size_t first;
+    size_t second;
+  };
+
+  struct Script
+  {
+    std::vector< Command > commands;
+    std::vector< Dictionary > slots;
+    std::vector< size_t > writers;
+    Tree< std::string, size_t > current;
+  };
+
+  void readScript(std::istream& in, const Registry& allTree, Script& script);
+  void executeScript(std::ostream& out, Script& script, size_t workers);
+  void saveScript(Registry& allTree, Script& script);
+  void executeBatch(std::istream& in, std::ostream& out, Registry& allTree, size_t workers);
+}
+
+#endif
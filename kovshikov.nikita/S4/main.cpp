@@ -2,6 +2,10 @@
 #include <functional>
 #include <iostream>
 #include <string>
+#ifdef KOVSHIKOV_BATCH_COMMANDS
+#include <thread>
+#include "batch.hpp"
+#endif
 #include "BinarySearchTree.hpp"
 #include "treeProcess.hpp"
 
@@ -14,11 +18,22 @@ int main(int argc, char ** argv )
   }
 
   using namespace kovshikov;
-  Tree< std::string, Tree< size_t, std::string > > allTree;
+  Registry allTree;
   std::ifstream file(argv[1]);
   readData(file, allTree);
 
-  Tree< std::string, std::function < void(Tree< std::string, Tree< size_t, std::string > >&) > > commands;
+#ifdef KOVSHIKOV_BATCH_COMMANDS
+  try
+  {
+    executeBatch(std::cin, std::cout, allTree, std::thread::hardware_concurrency());
+  }
+  catch(const std::exception& error)
+  {
+    std::cerr << error.what() << "\n";
+    return 1;
+  }
+#else
+  Tree< std::string, std::function < void(Registry&) > > commands;
   commands.insert("print", print);
   commands.insert("complement", getComplement);
   commands.insert("intersect", getIntersect);
@@ -40,5 +55,6 @@ int main(int argc, char ** argv )
       std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     }
   }
+#endif
   return 0;
 }
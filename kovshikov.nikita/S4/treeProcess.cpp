@@ -1,6 +1,12 @@
 #include "treeProcess.hpp"
+#include <algorithm>
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "outputBuffer.hpp"
 
 bool kovshikov::isDigit(std::string str)
 {
@@ -15,182 +21,241 @@ bool kovshikov::isDigit(std::string str)
   return true;
 }
 
-void kovshikov::readData(std::istream& in, Tree< std::string, Tree< size_t, std::string > >& allTree)
+namespace
 {
-  while(!in.eof())
+  const size_t blockSize = 1 << 20;
+
+  bool isNumber(const char* first, const char* last)
+  {
+    return std::all_of(first, last, [](char symbol)
+    {
+      return symbol >= '0' && symbol <= '9';
+    });
+  }
+
+  size_t parseKey(const char* first, const char* last)
   {
-    std::string dictionary = "";
-    std::getline(in, dictionary);
-    if(!dictionary.empty())
+    if(first == last)
+    {
+      throw std::invalid_argument("key is empty");
+    }
+    const unsigned long long maxKey = std::numeric_limits< long long >::max();
+    unsigned long long key = 0;
+    for(; first != last; ++first)
     {
-      createTree(allTree, dictionary);
+      unsigned long long digit = *first - '0';
+      if(key > (maxKey - digit) / 10)
+      {
+        throw std::out_of_range("key is too large");
+      }
+      key = key * 10 + digit;
     }
+    return key;
   }
+
+  kovshikov::Dictionary mergeDictionaries(const kovshikov::Dictionary& firstDictionary,
+      const kovshikov::Dictionary& secondDictionary, bool isOnlyFirst, bool isBoth, bool isOnlySecond)
+  {
+    std::vector< std::pair< size_t, std::string > > pairs;
+    kovshikov::Dictionary::ConstIterator iteratorFirst = firstDictionary.begin();
+    kovshikov::Dictionary::ConstIterator endFirst = firstDictionary.end();
+    kovshikov::Dictionary::ConstIterator iteratorSecond = secondDictionary.begin();
+    kovshikov::Dictionary::ConstIterator endSecond = secondDictionary.end();
+    while(iteratorFirst != endFirst && iteratorSecond != endSecond)
+    {
+      if(iteratorFirst -> first < iteratorSecond -> first)
+      {
+        if(isOnlyFirst)
+        {
+          pairs.push_back(*iteratorFirst);
+        }
+        ++iteratorFirst;
+      }
+      else if(iteratorSecond -> first < iteratorFirst -> first)
+      {
+        if(isOnlySecond)
+        {
+          pairs.push_back(*iteratorSecond);
+        }
+        ++iteratorSecond;
+      }
+      else
+      {
+        if(isBoth)
+        {
+          pairs.push_back(*iteratorFirst);
+        }
+        ++iteratorFirst;
+        ++iteratorSecond;
+      }
+    }
+    for(; isOnlyFirst && iteratorFirst != endFirst; ++iteratorFirst)
+    {
+      pairs.push_back(*iteratorFirst);
+    }
+    for(; isOnlySecond && iteratorSecond != endSecond; ++iteratorSecond)
+    {
+      pairs.push_back(*iteratorSecond);
+    }
+    return kovshikov::Dictionary::buildFromSorted(pairs.cbegin(), pairs.cend());
+  }
+}
+
+void kovshikov::readData(std::istream& in, Registry& allTree)
+{
+  std::vector< char > block(blockSize);
+  std::string tail = "";
+  while(in.read(block.data(), block.size()) || in.gcount() > 0)
+  {
+    const char* first = block.data();
+    const char* last = first + in.gcount();
+    const char* newline = std::find(first, last, '\n');
+    while(newline != last)
+    {
+      if(tail.empty())
+      {
+        createTree(allTree, first, newline);
+      }
+      else
+      {
+        tail.append(first, newline);
+        createTree(allTree, tail.data(), tail.data() + tail.length());
+        tail.clear();
+      }
+      first = newline + 1;
+      newline = std::find(first, last, '\n');
+    }
+    tail.append(first, last);
+  }
+  createTree(allTree, tail.data(), tail.data() + tail.length());
+}
+
+void kovshikov::createTree(Registry& allTree, std::string dictionary)
+{
+  createTree(allTree, dictionary.data(), dictionary.data() + dictionary.length());
 }
 
-void kovshikov::createTree(Tree< std::string, Tree< size_t, std::string > >& allTree, std::string dictionary)
+void kovshikov::createTree(Registry& allTree, const char* first, const char* last)
 {
-  std::string temp = "";
+  if(first == last)
+  {
+    return;
+  }
   std::string name = "";
   size_t key = 0;
-  std::string value = "";
-  Tree< size_t, std::string > tree;
+  bool hasValue = false;
+  std::vector< std::pair< size_t, std::string > > pairs;
   bool isName = true;
-  for(size_t i = 0; i < dictionary.length(); i++)
+  const char* space = std::find(first, last, ' ');
+  while(space != last)
   {
-    if(dictionary[i] != ' ')
+    if(isName)
     {
-      temp += dictionary[i];
+      name.assign(first, space);
+      isName = false;
     }
-    else if(dictionary[i] == ' ' && isName == true)
+    else if(isNumber(first, space))
     {
-      name = temp;
-      temp = "";
-      isName = false;
+      key = parseKey(first, space);
     }
     else
     {
-      if(isDigit(temp) == true)
-      {
-        key = std::stoll(temp);
-        temp = "";
-      }
-      else
-      {
-        value = temp;
-        temp = "";
-        tree.insert(key, value);
-      }
+      pairs.emplace_back(key, std::string(first, space));
+      hasValue = true;
     }
+    first = space + 1;
+    space = std::find(first, last, ' ');
   }
   if(key == 0)
   {
-    name = temp;
+    name.assign(first, last);
   }
-  if(!value.empty())
+  if(hasValue)
   {
-    value = temp;
-    tree.insert(key, value);
+    pairs.emplace_back(key, std::string(first, last));
   }
-  allTree.insert(name, tree);
+  using Pair = std::pair< size_t, std::string >;
+  std::stable_sort(pairs.begin(), pairs.end(), [](const Pair& first, const Pair& second)
+  {
+    return first.first < second.first;
+  });
+  auto unique = std::unique(pairs.rbegin(), pairs.rend(), [](const Pair& first, const Pair& second)
+  {
+    return first.first == second.first;
+  });
+  pairs.erase(pairs.begin(), unique.base());
+  allTree.insert(name, Dictionary::buildFromSorted(pairs.cbegin(), pairs.cend()));
 }
 
-void kovshikov::print(Tree< std::string, Tree< size_t, std::string > >& allTree)
+void kovshikov::printDictionary(std::ostream& out, const std::string& name, const Dictionary& tree)
 {
-  std::string dictionary;
-  std::cin >> dictionary;
-  Tree< size_t, std::string > tree = allTree.at(dictionary);
   auto outEmpty = std::bind(outText, std::placeholders::_1, "<EMPTY>");
   if(tree.isEmpty())
   {
-    outEmpty(std::cout);
+    outEmpty(out);
   }
   else
   {
-    Tree< size_t, std::string >::Iterator iterator = tree.begin();
-    Tree< size_t, std::string >::Iterator end = tree.end();
-    std::cout << dictionary << " ";
-    while(iterator != end)
+    OutputBuffer buffer(out);
+    buffer << name;
+    Dictionary::ConstIterator end = tree.end();
+    for(Dictionary::ConstIterator iterator = tree.begin(); iterator != end; ++iterator)
     {
-      std::pair< size_t, std::string > pair = *iterator;
-      if(++iterator == end)
-      {
-        std::cout << pair.first << " " << pair.second << "\n";
-      }
-      else
-      {
-        std::cout << pair.first << " " << pair.second << " ";
-      }
+      buffer << ' ' << iterator -> first << ' ' << iterator -> second;
     }
+    buffer << '\n';
   }
 }
 
-void kovshikov::getComplement(Tree< std::string, Tree< size_t, std::string > >& allTree)
+kovshikov::Dictionary kovshikov::complement(const Dictionary& firstDictionary, const Dictionary& secondDictionary)
+{
+  return mergeDictionaries(firstDictionary, secondDictionary, true, false, true);
+}
+
+kovshikov::Dictionary kovshikov::intersect(const Dictionary& firstDictionary, const Dictionary& secondDictionary)
+{
+  return mergeDictionaries(firstDictionary, secondDictionary, false, true, false);
+}
+
+kovshikov::Dictionary kovshikov::unite(const Dictionary& firstDictionary, const Dictionary& secondDictionary)
+{
+  return mergeDictionaries(firstDictionary, secondDictionary, true, true, true);
+}
+
+void kovshikov::print(Registry& allTree)
+{
+  std::string dictionary;
+  std::cin >> dictionary;
+  printDictionary(std::cout, dictionary, allTree.at(dictionary));
+}
+
+void kovshikov::getComplement(Registry& allTree)
 {
   std::string name;
   std::string  nameFirst;
   std::string  nameSecond;
   std:: cin >> name >> nameFirst >> nameSecond;
-  Tree< size_t, std::string > newTree;
-  Tree< size_t, std::string > firstDictionary = allTree.at(nameFirst);
-  Tree< size_t, std::string > secondDictionary = allTree.at(nameSecond);
-  Tree< size_t, std::string >::Iterator iteratorFirst = firstDictionary.begin();
-  Tree< size_t, std::string >::Iterator endFirst = firstDictionary.end();
-  Tree< size_t, std::string >::Iterator iteratorSecond = secondDictionary.begin();
-  Tree< size_t, std::string >::Iterator endSecond = secondDictionary.end();
-  while(iteratorFirst != endFirst)
-  {
-    std::pair< size_t, std::string > pair = *iteratorFirst;
-    if(secondDictionary.find(pair.first) == endSecond)
-    {
-      newTree.insert(pair);
-    }
-    iteratorFirst++;
-  }
-  while(iteratorSecond != endSecond)
-  {
-    std::pair< size_t, std::string > pair = *iteratorSecond;
-    if(firstDictionary.find(pair.first) == endFirst)
-    {
-      newTree.insert(pair);
-    }
-    iteratorSecond++;
-  }
+  Dictionary newTree = complement(allTree.at(nameFirst), allTree.at(nameSecond));
   allTree.insert(name, newTree);
 }
 
-void kovshikov::getIntersect(Tree< std::string, Tree< size_t, std::string > >& allTree)
+void kovshikov::getIntersect(Registry& allTree)
 {
   std::string name;
   std::string  nameFirst;
   std::string  nameSecond;
   std:: cin >> name >> nameFirst >> nameSecond;
-  Tree< size_t, std::string > newTree;
-  Tree< size_t, std::string > firstDictionary = allTree.at(nameFirst);
-  Tree< size_t, std::string > secondDictionary = allTree.at(nameSecond);
-  Tree< size_t, std::string >::Iterator iteratorFirst = firstDictionary.begin();
-  Tree< size_t, std::string >::Iterator endFirst = firstDictionary.end();
-  Tree< size_t, std::string >::Iterator endSecond = secondDictionary.end();
-  while(iteratorFirst != endFirst)
-  {
-    std::pair< size_t, std::string > pair = *iteratorFirst;
-    if(secondDictionary.find(pair.first) != endSecond)
-    {
-      newTree.insert(pair);
-    }
-    iteratorFirst++;
-  }
+  Dictionary newTree = intersect(allTree.at(nameFirst), allTree.at(nameSecond));
   allTree.insert(name, newTree);
 }
 
-void kovshikov::getUnion(Tree< std::string, Tree< size_t, std::string > >& allTree)
+void kovshikov::getUnion(Registry& allTree)
 {
   std::string name;
   std::string  nameFirst;
   std::string  nameSecond;
   std:: cin >> name >> nameFirst >> nameSecond;
-  Tree< size_t, std::string > newTree;
-  Tree< size_t, std::string > firstDictionary = allTree.at(nameFirst);
-  Tree< size_t, std::string > secondDictionary = allTree.at(nameSecond);
-  Tree< size_t, std::string >::Iterator iteratorFirst = firstDictionary.begin();
-  Tree< size_t, std::string >::Iterator endFirst = firstDictionary.end();
-  Tree< size_t, std::string >::Iterator iteratorSecond = secondDictionary.begin();
-  Tree< size_t, std::string >::Iterator endSecond = secondDictionary.end();
-  while(iteratorFirst != endFirst)
-  {
-    std::pair< size_t, std::string > pair = *iteratorFirst;
-    newTree.insert(pair);
-    iteratorFirst++;
-  }
-  while(iteratorSecond != endSecond)
-  {
-    std::pair< size_t, std::string > pair = *iteratorSecond;
-    if(firstDictionary.find(pair.first) == endFirst)
-    {
-      newTree.insert(pair);
-    }
-    iteratorSecond++;
-  }
+  Dictionary newTree = unite(allTree.at(nameFirst), allTree.at(nameSecond));
   allTree.insert(name, newTree);
 }
 
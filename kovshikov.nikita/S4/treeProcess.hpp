@@ -1,18 +1,37 @@
 #ifndef TREEPROCESS_HPP
 #define TREEPROCESS_HPP
+#include <iosfwd>
 #include <string>
 #include "BinarySearchTree.hpp"
+#ifdef KOVSHIKOV_PERSISTENT_DICTIONARIES
+#include "persistentTree.hpp"
+#else
+#include "cowTree.hpp"
+#endif
 
 namespace kovshikov
 {
-  void readData(std::istream& in, Tree< std::string, Tree< size_t, std::string > >& allTree);
-  void createTree(Tree< std::string, Tree< size_t, std::string > >& allTree, std::string dictionary);
+#ifdef KOVSHIKOV_PERSISTENT_DICTIONARIES
+  using Dictionary = PersistentTree< size_t, std::string >;
+#else
+  using Dictionary = CowTree< size_t, std::string >;
+#endif
+  using Registry = Tree< std::string, Dictionary >;
+
+  void readData(std::istream& in, Registry& allTree);
+  void createTree(Registry& allTree, std::string dictionary);
+  void createTree(Registry& allTree, const char* first, const char* last);
   bool isDigit(std::string str);
 
-  void print(Tree< std::string, Tree< size_t, std::string > >& allTree);
-  void getComplement(Tree< std::string, Tree< size_t, std::string > >& allTree);
-  void getIntersect(Tree< std::string, Tree< size_t, std::string > >& allTree);
-  void getUnion(Tree< std::string, Tree< size_t, std::string > >& allTree);
+  void printDictionary(std::ostream& out, const std::string& name, const Dictionary& tree);
+  Dictionary complement(const Dictionary& firstDictionary, const Dictionary& secondDictionary);
+  Dictionary intersect(const Dictionary& firstDictionary, const Dictionary& secondDictionary);
+  Dictionary unite(const Dictionary& firstDictionary, const Dictionary& secondDictionary);
+
+  void print(Registry& allTree);
+  void getComplement(Registry& allTree);
+  void getIntersect(Registry& allTree);
+  void getUnion(Registry& allTree);
 
   void outText(std::ostream& out, std::string string);
 }
@@ -2,29 +2,73 @@
 #define STRUCTSUMMA_CPP
 #include <utility>
 #include <limits>
-#include "queue.hpp"
+#include <stdexcept>
+#include "checkedSum.hpp"
+#include "outputBuffer.hpp"
 
 namespace kovshikov
 {
   struct TreeTraversal
   {
-    void operator()(const std::pair< const int, std::string >& element)
+    void operator()(const std::pair< int, std::string >& element)
     {
-      int max = std::numeric_limits< int >::max();
-      int min = std::numeric_limits< int >::min();
-      if(element.first > 0 && max - element.first < result)
+      if(!isSumReady)
+      {
+        result += element.first;
+      }
+    }
+    int getResult() const
+    {
+      if(result.overflowed())
       {
         throw std::overflow_error("<SUMMA OVERFLOWED>");
       }
-      else if(element.first < 0 && min - element.first > result)
+      else if(result.underflowed())
       {
         throw std::underflow_error("<SUMMA UNDERFLOWED>");
       }
-      result += element.first;
-      allValue.push(element.second);
+      return result.get();
+    }
+    CheckedSum< int > result;
+    bool isSumReady = false;
+  };
+
+  struct ValueOutput
+  {
+    explicit ValueOutput(OutputBuffer& out): buffer(&out) {};
+    void operator()(const std::pair< int, std::string >& element)
+    {
+      *buffer << ' ' << element.second;
+    }
+    OutputBuffer* buffer;
+  };
+
+  struct KeySum
+  {
+    void operator()(const std::pair< int, std::string >& element)
+    {
+      if(element.first > 0)
+      {
+        positive += element.first;
+      }
+      else
+      {
+        negative += element.first;
+      }
+    }
+    bool isSafe() const
+    {
+      return positive <= std::numeric_limits< int >::max() && negative >= std::numeric_limits< int >::min();
+    }
+    static KeySum merge(const KeySum& lhs, const KeySum& rhs)
+    {
+      KeySum sum;
+      sum.positive = lhs.positive + rhs.positive;
+      sum.negative = lhs.negative + rhs.negative;
+      return sum;
     }
-    Queue< std::string > allValue;
-    int result = 0;
+    long long positive = 0;
+    long long negative = 0;
   };
 }
 
@@ -1,4 +1,28 @@
 #include "process.hpp"
+#ifdef KOVSHIKOV_PARALLEL_REDUCE
+#include <thread>
+#endif
+#include "outputBuffer.hpp"
+
+namespace
+{
+  kovshikov::TreeTraversal prepareTraversal(const kovshikov::Tree< int, std::string >& tree)
+  {
+    kovshikov::TreeTraversal operation;
+#ifdef KOVSHIKOV_PARALLEL_REDUCE
+    size_t workers = std::thread::hardware_concurrency();
+    kovshikov::KeySum keys = tree.parallelReduce(kovshikov::KeySum(), kovshikov::KeySum::merge, workers == 0 ? 1 : workers);
+    if(keys.isSafe())
+    {
+      operation.result = kovshikov::CheckedSum< int >(static_cast< int >(keys.positive + keys.negative));
+      operation.isSumReady = true;
+    }
+#else
+    static_cast< void >(tree);
+#endif
+    return operation;
+  }
+}
 
 bool kovshikov::isDigit(std::string str)
 {
@@ -94,9 +118,16 @@ void kovshikov::getAscending(Tree< int, std::string >& tree)
   }
   else
   {
-    TreeTraversal operation;
-    TreeTraversal result = tree.traverse_lnr(operation);
-    outTraversal(result);
+    TreeTraversal operation = prepareTraversal(tree);
+    if(!operation.isSumReady)
+    {
+      operation = tree.traverse_lnr(operation);
+    }
+    int sum = operation.getResult();
+    OutputBuffer buffer(std::cout);
+    buffer << sum;
+    tree.traverse_lnr(ValueOutput(buffer));
+    buffer << '\n';
   }
 }
 
@@ -109,9 +140,16 @@ void kovshikov::getDescending(Tree< int, std::string >& tree)
   }
   else
   {
-    TreeTraversal operation;
-    TreeTraversal result = tree.traverse_rnl(operation);
-    outTraversal(result);
+    TreeTraversal operation = prepareTraversal(tree);
+    if(!operation.isSumReady)
+    {
+      operation = tree.traverse_rnl(operation);
+    }
+    int sum = operation.getResult();
+    OutputBuffer buffer(std::cout);
+    buffer << sum;
+    tree.traverse_rnl(ValueOutput(buffer));
+    buffer << '\n';
   }
 }
 
@@ -124,27 +162,16 @@ void kovshikov::getBreadth(Tree< int, std::string >& tree)
   }
   else
   {
-    TreeTraversal operation;
-    TreeTraversal result = tree.traverse_breadth(operation);
-    outTraversal(result);
-  }
-}
-
-void kovshikov::outTraversal(TreeTraversal& result)
-{
-  std::cout << result.result << " ";
-  while(!result.allValue.isEmpty())
-  {
-    std::cout << result.allValue.front();
-    result.allValue.pop();
-    if(!result.allValue.isEmpty())
-    {
-      std::cout << " ";
-    }
-    else
+    TreeTraversal operation = prepareTraversal(tree);
+    if(!operation.isSumReady)
     {
-      std::cout << "\n";
+      operation = tree.traverse_breadth(operation);
     }
+    int sum = operation.getResult();
+    OutputBuffer buffer(std::cout);
+    buffer << sum;
+    tree.traverse_breadth(ValueOutput(buffer));
+    buffer << '\n';
   }
 }
 
@@ -16,8 +16,6 @@ namespace kovshikov
   void getAscending(Tree< int, std::string >& tree);
   void getDescending(Tree< int, std::string >& tree);
   void getBreadth(Tree< int, std::string >& tree);
-
-  void outTraversal(TreeTraversal& result);
 }
 
 #endif
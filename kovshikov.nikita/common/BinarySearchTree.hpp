@@ -7,6 +7,12 @@
 #include <iterator>
 #include <memory>
 #include <utility>
+#ifdef KOVSHIKOV_PARALLEL_REDUCE
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+#endif
 #include "queue.hpp"
 #include "stack.hpp"
 
@@ -30,6 +36,9 @@ namespace kovshikov
     using Pair = std::pair< Key, Value >;
     using Range = std::pair< Iterator, Iterator >;
 
+    template< typename ForwardIt >
+    static Tree buildFromSorted(ForwardIt first, ForwardIt last);
+
     bool isEmpty() const noexcept;
     size_t getSize() const noexcept;
 
@@ -68,6 +77,11 @@ namespace kovshikov
     template< typename F >
     F traverse_breadth(F f) const;
 
+#ifdef KOVSHIKOV_PARALLEL_REDUCE
+    template< typename F, typename Combine >
+    F parallelReduce(F f, Combine combine, size_t workers) const;
+#endif
+
   private:
     Node* root_;
     Compare comp;
@@ -81,6 +95,15 @@ namespace kovshikov
     void balance(Node* node);
 
     void clear(Node* node);
+    Node* copyTree(Node* node, Node* father);
+
+    template< typename ForwardIt >
+    Node* buildSubtree(ForwardIt& first, size_t count);
+
+#ifdef KOVSHIKOV_PARALLEL_REDUCE
+    template< typename F >
+    static void reduceSubtree(Node* subtree, F& f);
+#endif
   };
 }
 
@@ -336,12 +359,52 @@ kovshikov::Tree< Key, Value, Compare >::Tree(const Tree& tree)
 {
   root_ = nullptr;
   comp = tree.comp;
-  Iterator iterator = tree.begin();
-  while(iterator != tree.end())
+  root_ = copyTree(tree.root_, nullptr);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename ForwardIt >
+kovshikov::Tree< Key, Value, Compare > kovshikov::Tree< Key, Value, Compare >::buildFromSorted(ForwardIt first, ForwardIt last)
+{
+  Tree tree;
+  size_t count = std::distance(first, last);
+  tree.root_ = tree.buildSubtree(first, count);
+  return tree;
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename ForwardIt >
+typename kovshikov::Tree< Key, Value, Compare >::Node* kovshikov::Tree< Key, Value, Compare >::buildSubtree(ForwardIt& first, size_t count)
+{
+  if(count == 0)
+  {
+    return nullptr;
+  }
+  Node* left = buildSubtree(first, count / 2);
+  Node* node = nullptr;
+  Node* right = nullptr;
+  try
   {
-    insert(iterator -> first, iterator -> second);
-    iterator++;
+    node = new Node(first -> first, first -> second, nullptr, left);
+    ++first;
+    right = buildSubtree(first, count - count / 2 - 1);
   }
+  catch(...)
+  {
+    clear(left);
+    delete node;
+    throw;
+  }
+  node -> right_ = right;
+  if(left != nullptr)
+  {
+    left -> father_ = node;
+  }
+  if(right != nullptr)
+  {
+    right -> father_ = node;
+  }
+  return node;
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -720,6 +783,27 @@ void kovshikov::Tree< Key, Value, Compare >::clear(Node* node)
   }
 }
 
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::Tree< Key, Value, Compare >::Node* kovshikov::Tree< Key, Value, Compare >::copyTree(Node* node, Node* father)
+{
+  if(node == nullptr)
+  {
+    return nullptr;
+  }
+  Node* newNode = new Node(node -> element_.first, node -> element_.second, father);
+  try
+  {
+    newNode -> left_ = copyTree(node -> left_, newNode);
+    newNode -> right_ = copyTree(node -> right_, newNode);
+  }
+  catch(...)
+  {
+    clear(newNode);
+    throw;
+  }
+  return newNode;
+}
+
 template< typename Key, typename Value, typename Compare >
 void kovshikov::Tree< Key, Value, Compare >::clear()
 {
@@ -741,104 +825,64 @@ template< typename Key, typename Value, typename Compare >
 typename kovshikov::Tree< Key, Value, Compare >::Iterator kovshikov::Tree< Key, Value, Compare >::erase(Iterator iterator)
 {
   Node* toDelete = iterator.node_;
-  Node* bigFather = toDelete -> father_;
-  Node* changer = nullptr;
-  Node* temp = nullptr;
-  Node* toBalance = nullptr;
   if(toDelete == nullptr)
   {
     return end();
   }
-  if(toDelete -> left_ == nullptr && toDelete -> right_ == nullptr)
-  {
-    if(bigFather != nullptr)
-    {
-      if(comp(toDelete -> element_.first, bigFather -> element_.first))
-      {
-        bigFather -> left_ = nullptr;
-      }
-      else
-      {
-        bigFather -> right_ = nullptr;
-      }
-      delete toDelete;
-      balance(bigFather);
-      return Iterator(bigFather, root_);
-    }
-    else
-    {
-      delete toDelete;
-      return end();
-    }
-  }
-  else if(toDelete -> left_ == nullptr && toDelete -> right_ != nullptr)
+  Iterator next = iterator;
+  ++next;
+  Node* bigFather = toDelete -> father_;
+  Node* changer = nullptr;
+  Node* toBalance = nullptr;
+  if(toDelete -> left_ == nullptr || toDelete -> right_ == nullptr)
   {
-    changer = toDelete -> right_;
-    temp = changer -> left_;
-    while(temp != nullptr)
-    {
-      changer = temp;
-      temp = temp -> left_;
-    }
-    toBalance = changer -> father_;
-    if(toBalance != toDelete)
-    {
-      toBalance -> left_ = nullptr;
-    }
+    changer = (toDelete -> left_ != nullptr) ? toDelete -> left_ : toDelete -> right_;
+    toBalance = bigFather;
   }
   else
   {
-    changer = toDelete -> left_;
-    temp = changer -> right_;
-    while(temp != nullptr)
-    {
-      changer = temp;
-      temp = temp -> right_;
-    }
-    toBalance = changer -> father_;
-    if(toBalance != toDelete)
+    changer = toDelete -> right_;
+    while(changer -> left_ != nullptr)
     {
-      toBalance -> right_ = nullptr;
+      changer = changer -> left_;
     }
-  }
-  if(bigFather != nullptr)
-  {
-    if(comp(toDelete -> element_.first, bigFather -> element_.first))
+    if(changer -> father_ != toDelete)
     {
-      bigFather -> left_ = changer;
+      toBalance = changer -> father_;
+      toBalance -> left_ = changer -> right_;
+      if(changer -> right_ != nullptr)
+      {
+        changer -> right_ -> father_ = toBalance;
+      }
+      changer -> right_ = toDelete -> right_;
+      toDelete -> right_ -> father_ = changer;
     }
     else
     {
-      bigFather -> right_ = changer;
+      toBalance = changer;
     }
-  }
-  changer -> father_ = bigFather;
-  if(toDelete -> left_ != nullptr && changer != toDelete -> left_)
-  {
     changer -> left_ = toDelete -> left_;
     toDelete -> left_ -> father_ = changer;
   }
-  if(toDelete -> right_ != nullptr && changer != toDelete -> right_)
+  if(changer != nullptr)
   {
-    changer -> right_ = toDelete -> right_;
-    toDelete -> right_ -> father_ = changer;
+    changer -> father_ = bigFather;
   }
-
-  if(toBalance != toDelete)
+  if(bigFather == nullptr)
   {
-    delete toDelete;
-    balance(toBalance);
+    root_ = changer;
   }
-  else
+  else if(bigFather -> left_ == toDelete)
   {
-    delete toDelete;
-    balance(changer);
+    bigFather -> left_ = changer;
   }
-  if(bigFather == nullptr)
+  else
   {
-    root_ = changer;
+    bigFather -> right_ = changer;
   }
-  return Iterator(changer, root_);
+  delete toDelete;
+  balance(toBalance);
+  return Iterator(next.node_, root_);
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -924,4 +968,115 @@ F kovshikov::Tree< Key, Value, Compare >::traverse_breadth(F f) const
   return f;
 }
 
+#ifdef KOVSHIKOV_PARALLEL_REDUCE
+template< typename Key, typename Value, typename Compare >
+template< typename F, typename Combine >
+F kovshikov::Tree< Key, Value, Compare >::parallelReduce(F f, Combine combine, size_t workers) const
+{
+  if(isEmpty())
+  {
+    return f;
+  }
+  if(workers <= 1)
+  {
+    reduceSubtree(root_, f);
+    return f;
+  }
+  F result = f;
+  std::vector< Node* > subtrees(1, root_);
+  size_t first = 0;
+  while(first < subtrees.size() && subtrees.size() - first < 4 * workers)
+  {
+    Node* current = subtrees[first++];
+    result(current -> element_);
+    if(current -> left_)
+    {
+      subtrees.push_back(current -> left_);
+    }
+    if(current -> right_)
+    {
+      subtrees.push_back(current -> right_);
+    }
+  }
+  size_t count = subtrees.size() - first;
+  std::vector< F > partials(count);
+  std::vector< std::exception_ptr > errors(count);
+  std::atomic< size_t > next(0);
+  auto work = [&]()
+  {
+    for(size_t i = next++; i < count; i = next++)
+    {
+      try
+      {
+        reduceSubtree(subtrees[first + i], partials[i]);
+      }
+      catch(...)
+      {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+  std::vector< std::thread > pool;
+  try
+  {
+    for(size_t i = 1; i < std::min(workers, count); i++)
+    {
+      pool.emplace_back(work);
+    }
+  }
+  catch(const std::system_error&)
+  {}
+  work();
+  for(size_t i = 0; i < pool.size(); i++)
+  {
+    pool[i].join();
+  }
+  for(size_t i = 0; i < count; i++)
+  {
+    if(errors[i])
+    {
+      std::rethrow_exception(errors[i]);
+    }
+    result = combine(result, partials[i]);
+  }
+  return result;
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+void kovshikov::Tree< Key, Value, Compare >::reduceSubtree(Node* subtree, F& f)
+{
+  Node* current = subtree;
+  while(current -> left_)
+  {
+    current = current -> left_;
+  }
+  while(true)
+  {
+    f(current -> element_);
+    if(current -> right_)
+    {
+      current = current -> right_;
+      while(current -> left_)
+      {
+        current = current -> left_;
+      }
+    }
+    else
+    {
+      while(current != subtree && current == current -> father_ -> right_)
+      {
+        current = current -> father_;
+      }
+      if(current == subtree)
+      {
+        return;
+      }
+      current = current -> father_;
+    }
+  }
+}
+
+#endif
+
 #endif
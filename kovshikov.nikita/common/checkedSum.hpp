@@ -0,0 +1,61 @@
+#ifndef CHECKEDSUM_HPP
+#define CHECKEDSUM_HPP
+#include <limits>
+
+namespace kovshikov
+{
+  template< typename T >
+  struct WideSum;
+
+  template<>
+  struct WideSum< int >
+  {
+    using type = long long;
+  };
+
+  template< typename T >
+  class CheckedSum
+  {
+  public:
+    CheckedSum(): sum_(0), state_(0) {};
+    explicit CheckedSum(T initial): sum_(initial), state_(0) {};
+
+    CheckedSum< T >& operator+=(T value) noexcept;
+
+    bool overflowed() const noexcept;
+    bool underflowed() const noexcept;
+    T get() const noexcept;
+  private:
+    typename WideSum< T >::type sum_;
+    int state_;
+  };
+}
+
+template< typename T >
+kovshikov::CheckedSum< T >& kovshikov::CheckedSum< T >::operator+=(T value) noexcept
+{
+  sum_ += value;
+  int crossed = (sum_ > std::numeric_limits< T >::max()) | ((sum_ < std::numeric_limits< T >::min()) << 1);
+  state_ |= (state_ == 0) ? crossed : 0;
+  return *this;
+}
+
+template< typename T >
+bool kovshikov::CheckedSum< T >::overflowed() const noexcept
+{
+  return state_ == 1;
+}
+
+template< typename T >
+bool kovshikov::CheckedSum< T >::underflowed() const noexcept
+{
+  return state_ == 2;
+}
+
+template< typename T >
+T kovshikov::CheckedSum< T >::get() const noexcept
+{
+  return static_cast< T >(sum_);
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef COWTREE_HPP
+#define COWTREE_HPP
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include "BinarySearchTree.hpp"
+
+namespace kovshikov
+{
+  template< typename Key, typename Value, typename Compare = std::less< Key > >
+  class CowTree
+  {
+  public:
+    using tree_t = Tree< Key, Value, Compare >;
+    using ConstIterator = typename tree_t::ConstIterator;
+
+    CowTree(): tree_(std::make_shared< tree_t >()) {};
+    CowTree(const CowTree& tree) = default;
+    CowTree(CowTree&& tree) noexcept = default;
+    ~CowTree() = default;
+
+    CowTree& operator=(const CowTree& tree) = default;
+    CowTree& operator=(CowTree&& tree) noexcept = default;
+
+    template< typename ForwardIt >
+    static CowTree buildFromSorted(ForwardIt first, ForwardIt last);
+
+    bool isEmpty() const noexcept;
+    size_t getSize() const noexcept;
+
+    ConstIterator begin() const noexcept;
+    ConstIterator end() const noexcept;
+    ConstIterator find(const Key& key) const;
+
+    void insert(const Key& key, const Value& value);
+
+    const tree_t& read() const noexcept;
+    tree_t& write();
+    long getUseCount() const noexcept;
+  private:
+    std::shared_ptr< tree_t > tree_;
+  };
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename ForwardIt >
+kovshikov::CowTree< Key, Value, Compare > kovshikov::CowTree< Key, Value, Compare >::buildFromSorted(ForwardIt first, ForwardIt last)
+{
+  CowTree tree;
+  tree.tree_ = std::make_shared< tree_t >(tree_t::buildFromSorted(first, last));
+  return tree;
+}
+
+template< typename Key, typename Value, typename Compare >
+bool kovshikov::CowTree< Key, Value, Compare >::isEmpty() const noexcept
+{
+  return tree_ -> isEmpty();
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t kovshikov::CowTree< Key, Value, Compare >::getSize() const noexcept
+{
+  return tree_ -> getSize();
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::CowTree< Key, Value, Compare >::ConstIterator kovshikov::CowTree< Key, Value, Compare >::begin() const noexcept
+{
+  return tree_ -> cbegin();
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::CowTree< Key, Value, Compare >::ConstIterator kovshikov::CowTree< Key, Value, Compare >::end() const noexcept
+{
+  return tree_ -> cend();
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::CowTree< Key, Value, Compare >::ConstIterator kovshikov::CowTree< Key, Value, Compare >::find(const Key& key) const
+{
+  return ConstIterator(tree_ -> find(key));
+}
+
+template< typename Key, typename Value, typename Compare >
+void kovshikov::CowTree< Key, Value, Compare >::insert(const Key& key, const Value& value)
+{
+  write().insert(key, value);
+}
+
+template< typename Key, typename Value, typename Compare >
+const typename kovshikov::CowTree< Key, Value, Compare >::tree_t& kovshikov::CowTree< Key, Value, Compare >::read() const noexcept
+{
+  return *tree_;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::CowTree< Key, Value, Compare >::tree_t& kovshikov::CowTree< Key, Value, Compare >::write()
+{
+  if(tree_.use_count() > 1)
+  {
+    tree_ = std::make_shared< tree_t >(*tree_);
+  }
+  return *tree_;
+}
+
+template< typename Key, typename Value, typename Compare >
+long kovshikov::CowTree< Key, Value, Compare >::getUseCount() const noexcept
+{
+  return tree_.use_count();
+}
+
+#endif
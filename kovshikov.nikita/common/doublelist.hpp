@@ -8,10 +8,11 @@
 #include <iterator>
 #include <memory>
 #include "node.hpp"
+#include "nodeAllocator.hpp"
 
 namespace kovshikov
 {
-  template < typename T >
+  template < typename T, typename NodeAllocator = NewNodeAllocator< T > >
   class DoubleList
   {
   public:
@@ -26,8 +27,8 @@ namespace kovshikov
     DoubleList(size_t size, const T &value);
     ~DoubleList();
 
-    DoubleList<T>& operator=(const DoubleList<T>& dl);
-    DoubleList<T>& operator=(DoubleList&& dl);
+    DoubleList& operator=(const DoubleList& dl);
+    DoubleList& operator=(DoubleList&& dl);
 
     T& front() const;
     T& back() const;
@@ -57,17 +58,20 @@ namespace kovshikov
     ConstIterator cbegin() const;
     ConstIterator cend() const;
 
+    const NodeAllocator& getAllocator() const noexcept;
+
   private:
     details::Node< T >* head_;
     details::Node< T >* tail_;
+    NodeAllocator allocator_;
   };
 }
 
-template< typename T >
-class kovshikov::DoubleList< T >::Iterator : public std::iterator< std::bidirectional_iterator_tag, T >
+template< typename T, typename NodeAllocator >
+class kovshikov::DoubleList< T, NodeAllocator >::Iterator : public std::iterator< std::bidirectional_iterator_tag, T >
 {
 public:
-  friend class DoubleList< T >;
+  friend class DoubleList< T, NodeAllocator >;
   using this_t = Iterator;
 
   Iterator(): node(nullptr) {};
@@ -92,16 +96,16 @@ private:
   details::Node< T >* node;
 };
 
-template< typename T >
-typename kovshikov::DoubleList< T >::Iterator::this_t & kovshikov::DoubleList< T >::Iterator::operator++()
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::Iterator::this_t & kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator++()
 {
   assert(node != nullptr);
   node = node->next;
   return *this;
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::Iterator::this_t kovshikov::DoubleList< T >::Iterator::operator++(int)
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::Iterator::this_t kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator++(int)
 {
   assert(node != nullptr);
   this_t result(*this);
@@ -109,16 +113,16 @@ typename kovshikov::DoubleList< T >::Iterator::this_t kovshikov::DoubleList< T >
   return result;
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::Iterator::this_t & kovshikov::DoubleList< T >::Iterator::operator--()
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::Iterator::this_t & kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator--()
 {
   assert(node != nullptr);
   node = node->prev;
   return *this;
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::Iterator::this_t kovshikov::DoubleList< T >::Iterator::operator--(int)
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::Iterator::this_t kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator--(int)
 {
   assert(node != nullptr);
   this_t result(*this);
@@ -126,37 +130,37 @@ typename kovshikov::DoubleList< T >::Iterator::this_t kovshikov::DoubleList< T >
   return result;
 }
 
-template< typename T >
-bool kovshikov::DoubleList< T >::Iterator::operator==(const this_t & other) const
+template< typename T, typename NodeAllocator >
+bool kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator==(const this_t & other) const
 {
   return node == other.node;
 }
 
-template< typename T >
-bool kovshikov::DoubleList< T >::Iterator::operator!=(const this_t & other) const
+template< typename T, typename NodeAllocator >
+bool kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator!=(const this_t & other) const
 {
   return !(other == *this);
 }
 
-template< typename T >
-T & kovshikov::DoubleList< T >::Iterator::operator*()
+template< typename T, typename NodeAllocator >
+T & kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator*()
 {
   assert(node != nullptr);
   return node->data;
 }
 
-template< typename T >
-T * kovshikov::DoubleList< T >::Iterator::operator->()
+template< typename T, typename NodeAllocator >
+T * kovshikov::DoubleList< T, NodeAllocator >::Iterator::operator->()
 {
   assert(node != nullptr);
   return std::addressof(node->data);
 }
 
-template < typename T >
-class kovshikov::DoubleList< T >::ConstIterator : public std::iterator< std::bidirectional_iterator_tag, T >
+template< typename T, typename NodeAllocator >
+class kovshikov::DoubleList< T, NodeAllocator >::ConstIterator : public std::iterator< std::bidirectional_iterator_tag, T >
 {
 public:
-  friend class DoubleList< T >;
+  friend class DoubleList< T, NodeAllocator >;
   using this_t = ConstIterator;
 
   ConstIterator(): iterator(nullptr) {};
@@ -181,66 +185,66 @@ private:
   Iterator iterator;
 };
 
-template< typename T >
-typename kovshikov::DoubleList< T >::ConstIterator::this_t & kovshikov::DoubleList< T >::ConstIterator::operator++()
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::this_t & kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator++()
 {
   assert(iterator != nullptr);
   iterator++;
   return iterator;
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::ConstIterator::this_t kovshikov::DoubleList< T >::ConstIterator::operator++(int)
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::this_t kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator++(int)
 {
   assert(iterator != nullptr);
   ++iterator;
   return iterator;
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::ConstIterator::this_t & kovshikov::DoubleList< T >::ConstIterator::operator--()
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::this_t & kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator--()
 {
   assert(iterator != nullptr);
   iterator--;
   return iterator;
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::ConstIterator::this_t kovshikov::DoubleList< T >::ConstIterator::operator--(int)
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::this_t kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator--(int)
 {
   assert(iterator != nullptr);
   --iterator;
   return iterator;
 }
 
-template< typename T >
-bool kovshikov::DoubleList< T >::ConstIterator::operator==(const this_t & other) const
+template< typename T, typename NodeAllocator >
+bool kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator==(const this_t & other) const
 {
   return iterator == other;
 }
 
-template< typename T >
-bool kovshikov::DoubleList< T >::ConstIterator::operator!=(const this_t & other) const
+template< typename T, typename NodeAllocator >
+bool kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator!=(const this_t & other) const
 {
   return !(other == iterator);
 }
 
-template< typename T >
-const T & kovshikov::DoubleList< T >::ConstIterator::operator*() const
+template< typename T, typename NodeAllocator >
+const T & kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator*() const
 {
   assert(iterator != nullptr);
   return iterator.node->data;
 }
 
-template< typename T >
-const T * kovshikov::DoubleList< T >::ConstIterator::operator->() const
+template< typename T, typename NodeAllocator >
+const T * kovshikov::DoubleList< T, NodeAllocator >::ConstIterator::operator->() const
 {
   assert(iterator != nullptr);
   return std::addressof(iterator.node->data);
 }
 
-template< typename T >
-kovshikov::DoubleList< T >::DoubleList(size_t size, const T &value)
+template< typename T, typename NodeAllocator >
+kovshikov::DoubleList< T, NodeAllocator >::DoubleList(size_t size, const T &value)
 {
   head_ = nullptr;
   tail_ = nullptr;
@@ -250,14 +254,14 @@ kovshikov::DoubleList< T >::DoubleList(size_t size, const T &value)
   }
 }
 
-template < typename T >
-kovshikov::DoubleList< T >::~DoubleList()
+template< typename T, typename NodeAllocator >
+kovshikov::DoubleList< T, NodeAllocator >::~DoubleList()
 {
   clear();
 }
 
-template < typename T >
-kovshikov::DoubleList< T >::DoubleList(const DoubleList& dl)
+template< typename T, typename NodeAllocator >
+kovshikov::DoubleList< T, NodeAllocator >::DoubleList(const DoubleList& dl)
 {
   this->head_ = nullptr;
   this->tail_ = nullptr;
@@ -269,16 +273,16 @@ kovshikov::DoubleList< T >::DoubleList(const DoubleList& dl)
   }
 }
 
-template < typename T >
-kovshikov::DoubleList< T >& kovshikov::DoubleList< T >::operator=(const DoubleList& dl)
+template< typename T, typename NodeAllocator >
+kovshikov::DoubleList< T, NodeAllocator >& kovshikov::DoubleList< T, NodeAllocator >::operator=(const DoubleList& dl)
 {
-  DoubleList< T > newDl(dl);
+  DoubleList< T, NodeAllocator > newDl(dl);
   this->swap(newDl);
   return *this;
 }
 
-template < typename T >
-kovshikov::DoubleList< T >::DoubleList(DoubleList&& dl)
+template< typename T, typename NodeAllocator >
+kovshikov::DoubleList< T, NodeAllocator >::DoubleList(DoubleList&& dl)
 {
   this->head_ = nullptr;
   this->tail_ = nullptr;
@@ -290,8 +294,8 @@ kovshikov::DoubleList< T >::DoubleList(DoubleList&& dl)
   }
 }
 
-template< typename T >
-kovshikov::DoubleList< T >& kovshikov::DoubleList< T >::operator=(DoubleList&& dl)
+template< typename T, typename NodeAllocator >
+kovshikov::DoubleList< T, NodeAllocator >& kovshikov::DoubleList< T, NodeAllocator >::operator=(DoubleList&& dl)
 {
   this->clear();
   details::Node< T > *temp = std::move(dl.head_);
@@ -303,26 +307,26 @@ kovshikov::DoubleList< T >& kovshikov::DoubleList< T >::operator=(DoubleList&& d
   return *this;
 }
 
-template < typename T >
-T& kovshikov::DoubleList< T >::front() const
+template< typename T, typename NodeAllocator >
+T& kovshikov::DoubleList< T, NodeAllocator >::front() const
 {
   return head_->data;
 }
 
-template < typename T >
-T& kovshikov::DoubleList< T >::back() const
+template< typename T, typename NodeAllocator >
+T& kovshikov::DoubleList< T, NodeAllocator >::back() const
 {
   return tail_->data;
 }
 
-template < typename T >
-bool kovshikov::DoubleList< T >::empty() const noexcept
+template< typename T, typename NodeAllocator >
+bool kovshikov::DoubleList< T, NodeAllocator >::empty() const noexcept
 {
   return (head_ == nullptr && tail_ == nullptr) ? true : false;
 }
 
-template < typename T >
-size_t kovshikov::DoubleList< T >::size() const
+template< typename T, typename NodeAllocator >
+size_t kovshikov::DoubleList< T, NodeAllocator >::size() const
 {
   size_t size = 0;
   Iterator current = begin();
@@ -334,10 +338,10 @@ size_t kovshikov::DoubleList< T >::size() const
   return size;
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::pushFront(const T &value)
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::pushFront(const T &value)
 {
-  details::Node< T >* newNode = new details::Node< T >(value);
+  details::Node< T >* newNode = allocator_.create(value);
   if (this->empty() == true)
   {
     head_ = newNode;
@@ -351,10 +355,10 @@ void kovshikov::DoubleList< T >::pushFront(const T &value)
   }
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::pushBack(const T& value)
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::pushBack(const T& value)
 {
-  details::Node< T >* newNode = new details::Node< T >(value);
+  details::Node< T >* newNode = allocator_.create(value);
   if (this->empty() == true)
   {
     head_ = newNode;
@@ -368,13 +372,13 @@ void kovshikov::DoubleList< T >::pushBack(const T& value)
   }
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::popFront() noexcept
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::popFront() noexcept
 {
   if(head_ != nullptr && tail_ != nullptr)
   {
     details::Node< T >* temp = head_->next;
-    delete head_;
+    allocator_.destroy(head_);
     head_ = temp;
     if(head_ == nullptr)
     {
@@ -387,13 +391,13 @@ void kovshikov::DoubleList< T >::popFront() noexcept
   }
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::popBack() noexcept
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::popBack() noexcept
 {
   if(head_ != nullptr && tail_ != nullptr)
   {
     details::Node< T >* temp = tail_->prev;
-    delete tail_;
+    allocator_.destroy(tail_);
     tail_ = temp;
     if(tail_ == nullptr)
     {
@@ -406,32 +410,32 @@ void kovshikov::DoubleList< T >::popBack() noexcept
   }
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::push_front(const T &value)
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::push_front(const T &value)
 {
   pushFront(value);
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::push_back(const T& value)
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::push_back(const T& value)
 {
   pushBack(value);
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::pop_front() noexcept
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::pop_front() noexcept
 {
   popFront();
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::pop_back() noexcept
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::pop_back() noexcept
 {
   popBack();
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::clear() noexcept
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::clear() noexcept
 {
   while (head_ && tail_)
   {
@@ -439,8 +443,8 @@ void kovshikov::DoubleList< T >::clear() noexcept
   }
 }
 
-template < typename T >
-void kovshikov::DoubleList< T >::swap(DoubleList& dl) noexcept
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::swap(DoubleList& dl) noexcept
 {
   details::Node< T >* tempHead = dl.head_;
   details::Node< T >* tempTail = dl.tail_;
@@ -448,10 +452,11 @@ void kovshikov::DoubleList< T >::swap(DoubleList& dl) noexcept
   this->head_ = tempHead;
   dl.tail_ = this->tail_;
   this->tail_ = tempTail;
+  allocator_.swap(dl.allocator_);
 }
 
-template< typename T >
-void kovshikov::DoubleList< T >::remove(const T &value)
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::remove(const T &value)
 {
   Iterator iterator = this->begin();
   while(iterator != this->end())
@@ -475,15 +480,15 @@ void kovshikov::DoubleList< T >::remove(const T &value)
         tempPrev->next = tempNext;
         tempNext->prev = tempPrev;
       }
-      delete iteratorToDelete.node;
+      allocator_.destroy(iteratorToDelete.node);
     }
     iterator++;
    }
 }
 
-template< typename T >
+template< typename T, typename NodeAllocator >
 template< class Predicate >
-void kovshikov::DoubleList< T >::remove_if(Predicate pred)
+void kovshikov::DoubleList< T, NodeAllocator >::remove_if(Predicate pred)
 {
   Iterator iterator = this->begin();
   while(iterator != this->end())
@@ -507,14 +512,14 @@ void kovshikov::DoubleList< T >::remove_if(Predicate pred)
         tempPrev->next = tempNext;
         tempNext->prev = tempPrev;
       }
-      delete iteratorToDelete.node;
+      allocator_.destroy(iteratorToDelete.node);
     }
     iterator++;
    }
 }
 
-template< typename T >
-void kovshikov::DoubleList< T >::assign(size_t size, const T &value)
+template< typename T, typename NodeAllocator >
+void kovshikov::DoubleList< T, NodeAllocator >::assign(size_t size, const T &value)
 {
   this->clear();
   for(size_t i = 0; i < size; i++)
@@ -523,14 +528,14 @@ void kovshikov::DoubleList< T >::assign(size_t size, const T &value)
   }
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::Iterator kovshikov::DoubleList< T >::begin() const
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::Iterator kovshikov::DoubleList< T, NodeAllocator >::begin() const
 {
   return Iterator(head_);
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::Iterator kovshikov::DoubleList< T >::end() const
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::Iterator kovshikov::DoubleList< T, NodeAllocator >::end() const
 {
   if(this->empty())
   {
@@ -543,14 +548,14 @@ typename kovshikov::DoubleList< T >::Iterator kovshikov::DoubleList< T >::end()
   }
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::ConstIterator kovshikov::DoubleList< T >::cbegin() const
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::ConstIterator kovshikov::DoubleList< T, NodeAllocator >::cbegin() const
 {
   return ConstIterator(head_);
 }
 
-template< typename T >
-typename kovshikov::DoubleList< T >::ConstIterator kovshikov::DoubleList< T >::cend() const
+template< typename T, typename NodeAllocator >
+typename kovshikov::DoubleList< T, NodeAllocator >::ConstIterator kovshikov::DoubleList< T, NodeAllocator >::cend() const
 {
   if(this->empty)
   {
@@ -563,4 +568,10 @@ typename kovshikov::DoubleList< T >::ConstIterator kovshikov::DoubleList< T >::c
   }
 }
 
+template< typename T, typename NodeAllocator >
+const NodeAllocator& kovshikov::DoubleList< T, NodeAllocator >::getAllocator() const noexcept
+{
+  return allocator_;
+}
+
 #endif
@@ -0,0 +1,192 @@
+#ifndef NODEALLOCATOR_HPP
+#define NODEALLOCATOR_HPP
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "node.hpp"
+
+namespace kovshikov
+{
+  struct AllocatorStats
+  {
+    size_t allocations;
+    size_t deallocations;
+    size_t capacity;
+    size_t slabs;
+  };
+
+  template< typename T >
+  class NewNodeAllocator
+  {
+  public:
+    NewNodeAllocator(): stats_{0, 0, 0, 0} {};
+    NewNodeAllocator(const NewNodeAllocator&): NewNodeAllocator() {};
+    NewNodeAllocator& operator=(const NewNodeAllocator&) = delete;
+    ~NewNodeAllocator() = default;
+
+    details::Node< T >* create(const T& value);
+    void destroy(details::Node< T >* node) noexcept;
+    void swap(NewNodeAllocator& other) noexcept;
+
+    const AllocatorStats& getStats() const noexcept;
+  private:
+    AllocatorStats stats_;
+  };
+
+  template< typename T, size_t MaxSlabSize = 1024 >
+  class PoolNodeAllocator
+  {
+  public:
+    PoolNodeAllocator(): slabs_(nullptr), free_(nullptr), nextSlabSize_(8), stats_{0, 0, 0, 0} {};
+    PoolNodeAllocator(const PoolNodeAllocator&): PoolNodeAllocator() {};
+    PoolNodeAllocator& operator=(const PoolNodeAllocator&) = delete;
+    ~PoolNodeAllocator();
+
+    details::Node< T >* create(const T& value);
+    void destroy(details::Node< T >* node) noexcept;
+    void swap(PoolNodeAllocator& other) noexcept;
+
+    const AllocatorStats& getStats() const noexcept;
+  private:
+    using storage_t = typename std::aligned_storage< sizeof(details::Node< T >), alignof(details::Node< T >) >::type;
+    union Cell
+    {
+      Cell* next;
+      storage_t storage;
+    };
+    struct Slab
+    {
+      Slab* next;
+      Cell* cells;
+    };
+
+    Slab* slabs_;
+    Cell* free_;
+    size_t nextSlabSize_;
+    AllocatorStats stats_;
+
+    void addSlab();
+  };
+}
+
+template< typename T >
+kovshikov::details::Node< T >* kovshikov::NewNodeAllocator< T >::create(const T& value)
+{
+  details::Node< T >* node = new details::Node< T >(value);
+  stats_.allocations += 1;
+  return node;
+}
+
+template< typename T >
+void kovshikov::NewNodeAllocator< T >::destroy(details::Node< T >* node) noexcept
+{
+  delete node;
+  stats_.deallocations += 1;
+}
+
+template< typename T >
+void kovshikov::NewNodeAllocator< T >::swap(NewNodeAllocator& other) noexcept
+{
+  std::swap(stats_, other.stats_);
+}
+
+template< typename T >
+const kovshikov::AllocatorStats& kovshikov::NewNodeAllocator< T >::getStats() const noexcept
+{
+  return stats_;
+}
+
+template< typename T, size_t MaxSlabSize >
+kovshikov::PoolNodeAllocator< T, MaxSlabSize >::~PoolNodeAllocator()
+{
+  while(slabs_ != nullptr)
+  {
+    Slab* next = slabs_->next;
+    delete[] slabs_->cells;
+    delete slabs_;
+    slabs_ = next;
+  }
+}
+
+template< typename T, size_t MaxSlabSize >
+void kovshikov::PoolNodeAllocator< T, MaxSlabSize >::addSlab()
+{
+  Slab* slab = new Slab{slabs_, nullptr};
+  try
+  {
+    slab->cells = new Cell[nextSlabSize_];
+  }
+  catch(...)
+  {
+    delete slab;
+    throw;
+  }
+  for(size_t i = 0; i < nextSlabSize_; i++)
+  {
+    slab->cells[i].next = free_;
+    free_ = slab->cells + i;
+  }
+  slabs_ = slab;
+  stats_.slabs += 1;
+  stats_.capacity += nextSlabSize_;
+  if(nextSlabSize_ < MaxSlabSize)
+  {
+    nextSlabSize_ *= 2;
+  }
+}
+
+template< typename T, size_t MaxSlabSize >
+kovshikov::details::Node< T >* kovshikov::PoolNodeAllocator< T, MaxSlabSize >::create(const T& value)
+{
+  if(free_ == nullptr)
+  {
+    addSlab();
+  }
+  Cell* cell = free_;
+  free_ = cell->next;
+  details::Node< T >* node = nullptr;
+  try
+  {
+    node = new (&cell->storage) details::Node< T >(value);
+  }
+  catch(...)
+  {
+    cell->next = free_;
+    free_ = cell;
+    throw;
+  }
+  stats_.allocations += 1;
+  return node;
+}
+
+template< typename T, size_t MaxSlabSize >
+void kovshikov::PoolNodeAllocator< T, MaxSlabSize >::destroy(details::Node< T >* node) noexcept
+{
+  if(node == nullptr)
+  {
+    return;
+  }
+  node->~Node();
+  Cell* cell = new (node) Cell;
+  cell->next = free_;
+  free_ = cell;
+  stats_.deallocations += 1;
+}
+
+template< typename T, size_t MaxSlabSize >
+void kovshikov::PoolNodeAllocator< T, MaxSlabSize >::swap(PoolNodeAllocator& other) noexcept
+{
+  std::swap(slabs_, other.slabs_);
+  std::swap(free_, other.free_);
+  std::swap(nextSlabSize_, other.nextSlabSize_);
+  std::swap(stats_, other.stats_);
+}
+
+template< typename T, size_t MaxSlabSize >
+const kovshikov::AllocatorStats& kovshikov::PoolNodeAllocator< T, MaxSlabSize >::getStats() const noexcept
+{
+  return stats_;
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef OUTPUTBUFFER_HPP
+#define OUTPUTBUFFER_HPP
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace kovshikov
+{
+  class OutputBuffer
+  {
+  public:
+    explicit OutputBuffer(std::ostream& out, size_t capacity = 65536):
+      out_(out),
+      buffer_(),
+      capacity_(capacity)
+    {};
+    OutputBuffer(const OutputBuffer& buffer) = delete;
+    ~OutputBuffer();
+
+    OutputBuffer& operator=(const OutputBuffer& buffer) = delete;
+
+    OutputBuffer& operator<<(char symbol);
+    OutputBuffer& operator<<(const char* string);
+    OutputBuffer& operator<<(const std::string& string);
+    template< typename Integer >
+    typename std::enable_if< std::is_integral< Integer >::value, OutputBuffer& >::type operator<<(Integer value);
+
+    void write(const char* data, size_t length);
+    void flush();
+  private:
+    std::ostream& out_;
+    std::string buffer_;
+    size_t capacity_;
+
+    template< typename Integer >
+    void writeInteger(Integer value, std::true_type);
+    template< typename Integer >
+    void writeInteger(Integer value, std::false_type);
+    void writeUnsigned(unsigned long long value, bool isNegative);
+  };
+}
+
+inline kovshikov::OutputBuffer::~OutputBuffer()
+{
+  try
+  {
+    flush();
+  }
+  catch(...)
+  {}
+}
+
+inline kovshikov::OutputBuffer& kovshikov::OutputBuffer::operator<<(char symbol)
+{
+  buffer_.push_back(symbol);
+  if(buffer_.size() >= capacity_)
+  {
+    flush();
+  }
+  return *this;
+}
+
+inline kovshikov::OutputBuffer& kovshikov::OutputBuffer::operator<<(const char* string)
+{
+  write(string, std::strlen(string));
+  return *this;
+}
+
+inline kovshikov::OutputBuffer& kovshikov::OutputBuffer::operator<<(const std::string& string)
+{
+  write(string.data(), string.length());
+  return *this;
+}
+
+template< typename Integer >
+typename std::enable_if< std::is_integral< Integer >::value, kovshikov::OutputBuffer& >::type kovshikov::OutputBuffer::operator<<(Integer value)
+{
+  writeInteger(value, std::is_signed< Integer >());
+  return *this;
+}
+
+inline void kovshikov::OutputBuffer::write(const char* data, size_t length)
+{
+  if(buffer_.size() + length > capacity_)
+  {
+    flush();
+    if(length >= capacity_)
+    {
+      out_.write(data, length);
+      return;
+    }
+  }
+  buffer_.append(data, length);
+}
+
+inline void kovshikov::OutputBuffer::flush()
+{
+  out_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+template< typename Integer >
+void kovshikov::OutputBuffer::writeInteger(Integer value, std::true_type)
+{
+  unsigned long long magnitude = static_cast< unsigned long long >(value);
+  writeUnsigned(value < 0 ? 0 - magnitude : magnitude, value < 0);
+}
+
+template< typename Integer >
+void kovshikov::OutputBuffer::writeInteger(Integer value, std::false_type)
+{
+  writeUnsigned(value, false);
+}
+
+inline void kovshikov::OutputBuffer::writeUnsigned(unsigned long long value, bool isNegative)
+{
+  char digits[24];
+  char* begin = digits + sizeof(digits);
+  do
+  {
+    *--begin = static_cast< char >('0' + value % 10);
+    value /= 10;
+  }
+  while(value != 0);
+  if(isNegative)
+  {
+    *--begin = '-';
+  }
+  write(begin, digits + sizeof(digits) - begin);
+}
+
+#endif
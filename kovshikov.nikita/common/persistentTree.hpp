@@ -0,0 +1,330 @@
+#ifndef PERSISTENTTREE_HPP
+#define PERSISTENTTREE_HPP
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace kovshikov
+{
+  template< typename Key, typename Value, typename Compare = std::less< Key > >
+  class PersistentTree
+  {
+  public:
+    class ConstIterator;
+    using Pair = std::pair< Key, Value >;
+
+    PersistentTree(): root_(nullptr), size_(0), comp_(Compare()) {};
+    PersistentTree(const PersistentTree& tree) = default;
+    PersistentTree(PersistentTree&& tree) noexcept = default;
+    ~PersistentTree() = default;
+
+    PersistentTree& operator=(const PersistentTree& tree) = default;
+    PersistentTree& operator=(PersistentTree&& tree) noexcept = default;
+
+    template< typename ForwardIt >
+    static PersistentTree buildFromSorted(ForwardIt first, ForwardIt last);
+
+    bool isEmpty() const noexcept;
+    size_t getSize() const noexcept;
+
+    ConstIterator begin() const;
+    ConstIterator end() const noexcept;
+    ConstIterator find(const Key& key) const;
+
+    void insert(const Key& key, const Value& value);
+  private:
+    class Node;
+    using NodePtr = std::shared_ptr< const Node >;
+
+    NodePtr root_;
+    size_t size_;
+    Compare comp_;
+
+    static size_t getHeight(const NodePtr& node) noexcept;
+    static NodePtr makeNode(const Pair& element, const NodePtr& left, const NodePtr& right);
+    static NodePtr balance(const Pair& element, const NodePtr& left, const NodePtr& right);
+    NodePtr insert(const NodePtr& node, const Key& key, const Value& value, bool& isAdded) const;
+    template< typename ForwardIt >
+    static NodePtr buildSubtree(ForwardIt& first, size_t count);
+  };
+}
+
+template< typename Key, typename Value, typename Compare >
+class kovshikov::PersistentTree< Key, Value, Compare >::Node
+{
+public:
+  friend class PersistentTree< Key, Value, Compare >;
+  Node(const Pair& element, const NodePtr& left, const NodePtr& right):
+    element_(element),
+    left_(left),
+    right_(right),
+    height_(std::max(getHeight(left), getHeight(right)) + 1)
+  {};
+
+private:
+  Pair element_;
+  NodePtr left_;
+  NodePtr right_;
+  size_t height_;
+};
+
+template< typename Key, typename Value, typename Compare >
+class kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator : public std::iterator< std::forward_iterator_tag, Pair >
+{
+public:
+  friend class PersistentTree< Key, Value, Compare >;
+  using this_t = ConstIterator;
+
+  ConstIterator(): depth_(0) {};
+  ConstIterator(const this_t& other);
+  ~ConstIterator() = default;
+
+  this_t& operator=(const this_t& other);
+
+  this_t& operator++();
+  this_t operator++(int);
+
+  bool operator==(const this_t& other) const;
+  bool operator!=(const this_t& other) const;
+
+  const Pair& operator*() const;
+  const Pair* operator->() const;
+
+private:
+  static constexpr size_t maxHeight = 96;
+  const Node* path_[maxHeight];
+  size_t depth_;
+
+  void push(const Node* node);
+  void pushLeft(const Node* node);
+};
+
+template< typename Key, typename Value, typename Compare >
+kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::ConstIterator(const this_t& other):
+  depth_(other.depth_)
+{
+  std::copy(other.path_, other.path_ + other.depth_, path_);
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator& kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator=(const this_t& other)
+{
+  depth_ = other.depth_;
+  std::copy(other.path_, other.path_ + other.depth_, path_);
+  return *this;
+}
+
+template< typename Key, typename Value, typename Compare >
+void kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::push(const Node* node)
+{
+  path_[depth_] = node;
+  depth_ += 1;
+}
+
+template< typename Key, typename Value, typename Compare >
+void kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::pushLeft(const Node* node)
+{
+  while(node != nullptr)
+  {
+    push(node);
+    node = node -> left_.get();
+  }
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator& kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator++()
+{
+  depth_ -= 1;
+  const Node* current = path_[depth_];
+  pushLeft(current -> right_.get());
+  return *this;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator++(int)
+{
+  this_t result = *this;
+  ++(*this);
+  return result;
+}
+
+template< typename Key, typename Value, typename Compare >
+bool kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator==(const this_t& other) const
+{
+  if(depth_ == 0 || other.depth_ == 0)
+  {
+    return depth_ == other.depth_;
+  }
+  return path_[depth_ - 1] == other.path_[other.depth_ - 1];
+}
+
+template< typename Key, typename Value, typename Compare >
+bool kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator!=(const this_t& other) const
+{
+  return !(*this == other);
+}
+
+template< typename Key, typename Value, typename Compare >
+const typename kovshikov::PersistentTree< Key, Value, Compare >::Pair& kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator*() const
+{
+  return path_[depth_ - 1] -> element_;
+}
+
+template< typename Key, typename Value, typename Compare >
+const typename kovshikov::PersistentTree< Key, Value, Compare >::Pair* kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator::operator->() const
+{
+  return std::addressof(**this);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename ForwardIt >
+kovshikov::PersistentTree< Key, Value, Compare > kovshikov::PersistentTree< Key, Value, Compare >::buildFromSorted(ForwardIt first, ForwardIt last)
+{
+  PersistentTree tree;
+  tree.size_ = std::distance(first, last);
+  tree.root_ = buildSubtree(first, tree.size_);
+  return tree;
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename ForwardIt >
+typename kovshikov::PersistentTree< Key, Value, Compare >::NodePtr kovshikov::PersistentTree< Key, Value, Compare >::buildSubtree(ForwardIt& first, size_t count)
+{
+  if(count == 0)
+  {
+    return nullptr;
+  }
+  NodePtr left = buildSubtree(first, count / 2);
+  const Pair& element = *first;
+  ++first;
+  NodePtr right = buildSubtree(first, count - count / 2 - 1);
+  return makeNode(element, left, right);
+}
+
+template< typename Key, typename Value, typename Compare >
+bool kovshikov::PersistentTree< Key, Value, Compare >::isEmpty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t kovshikov::PersistentTree< Key, Value, Compare >::getSize() const noexcept
+{
+  return size_;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator kovshikov::PersistentTree< Key, Value, Compare >::begin() const
+{
+  ConstIterator iterator;
+  iterator.pushLeft(root_.get());
+  return iterator;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator kovshikov::PersistentTree< Key, Value, Compare >::end() const noexcept
+{
+  return ConstIterator();
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::ConstIterator kovshikov::PersistentTree< Key, Value, Compare >::find(const Key& key) const
+{
+  ConstIterator iterator;
+  const Node* current = root_.get();
+  while(current != nullptr)
+  {
+    if(comp_(key, current -> element_.first))
+    {
+      iterator.push(current);
+      current = current -> left_.get();
+    }
+    else if(comp_(current -> element_.first, key))
+    {
+      current = current -> right_.get();
+    }
+    else
+    {
+      iterator.push(current);
+      return iterator;
+    }
+  }
+  return end();
+}
+
+template< typename Key, typename Value, typename Compare >
+void kovshikov::PersistentTree< Key, Value, Compare >::insert(const Key& key, const Value& value)
+{
+  bool isAdded = false;
+  root_ = insert(root_, key, value, isAdded);
+  if(isAdded)
+  {
+    size_ += 1;
+  }
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t kovshikov::PersistentTree< Key, Value, Compare >::getHeight(const NodePtr& node) noexcept
+{
+  return (node == nullptr) ? 0 : node -> height_;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::NodePtr kovshikov::PersistentTree< Key, Value, Compare >::makeNode(const Pair& element, const NodePtr& left, const NodePtr& right)
+{
+  return std::make_shared< const Node >(element, left, right);
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::NodePtr kovshikov::PersistentTree< Key, Value, Compare >::balance(const Pair& element, const NodePtr& left, const NodePtr& right)
+{
+  size_t leftHeight = getHeight(left);
+  size_t rightHeight = getHeight(right);
+  if(leftHeight > rightHeight + 1)
+  {
+    if(getHeight(left -> left_) >= getHeight(left -> right_))
+    {
+      return makeNode(left -> element_, left -> left_, makeNode(element, left -> right_, right));
+    }
+    const NodePtr& middle = left -> right_;
+    NodePtr newLeft = makeNode(left -> element_, left -> left_, middle -> left_);
+    NodePtr newRight = makeNode(element, middle -> right_, right);
+    return makeNode(middle -> element_, newLeft, newRight);
+  }
+  else if(rightHeight > leftHeight + 1)
+  {
+    if(getHeight(right -> right_) >= getHeight(right -> left_))
+    {
+      return makeNode(right -> element_, makeNode(element, left, right -> left_), right -> right_);
+    }
+    const NodePtr& middle = right -> left_;
+    NodePtr newLeft = makeNode(element, left, middle -> left_);
+    NodePtr newRight = makeNode(right -> element_, middle -> right_, right -> right_);
+    return makeNode(middle -> element_, newLeft, newRight);
+  }
+  return makeNode(element, left, right);
+}
+
+template< typename Key, typename Value, typename Compare >
+typename kovshikov::PersistentTree< Key, Value, Compare >::NodePtr kovshikov::PersistentTree< Key, Value, Compare >::insert(const NodePtr& node, const Key& key, const Value& value, bool& isAdded) const
+{
+  if(node == nullptr)
+  {
+    isAdded = true;
+    return makeNode(std::make_pair(key, value), nullptr, nullptr);
+  }
+  if(comp_(key, node -> element_.first))
+  {
+    return balance(node -> element_, insert(node -> left_, key, value, isAdded), node -> right_);
+  }
+  else if(comp_(node -> element_.first, key))
+  {
+    return balance(node -> element_, node -> left_, insert(node -> right_, key, value, isAdded));
+  }
+  return makeNode(std::make_pair(key, value), node -> left_, node -> right_);
+}
+
+#endif
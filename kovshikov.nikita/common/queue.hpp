@@ -4,13 +4,13 @@
 
 namespace kovshikov
 {
-  template< typename T >
+  template< typename T, typename NodeAllocator = PoolNodeAllocator< T > >
   class Queue
   {
   public:
     Queue() = default;
-    Queue(const Queue< T >& q);
-    Queue(Queue< T >&& q);
+    Queue(const Queue< T, NodeAllocator >& q);
+    Queue(Queue< T, NodeAllocator >&& q);
     ~Queue() = default;
 
     void push(const T& val);
@@ -22,53 +22,55 @@ namespace kovshikov
     size_t getSize() const;
     bool isEmpty() const noexcept;
 
+    const NodeAllocator& getAllocator() const noexcept;
+
   private:
-    DoubleList< T > queue;
+    DoubleList< T, NodeAllocator > queue;
   };
 }
 
-template< typename T >
-kovshikov::Queue< T >::Queue(const Queue< T >& q)
+template< typename T, typename NodeAllocator >
+kovshikov::Queue< T, NodeAllocator >::Queue(const Queue< T, NodeAllocator >& q)
 {
   queue = q.queue;
 }
 
-template< typename T >
-kovshikov::Queue< T >::Queue(Queue< T >&& q)
+template< typename T, typename NodeAllocator >
+kovshikov::Queue< T, NodeAllocator >::Queue(Queue< T, NodeAllocator >&& q)
 {
   queue = std::move(q.queue);
 }
 
-template< typename T >
-void kovshikov::Queue< T >::push(const T& val)
+template< typename T, typename NodeAllocator >
+void kovshikov::Queue< T, NodeAllocator >::push(const T& val)
 {
   queue.pushBack(val);
 }
 
-template< typename T >
-void kovshikov::Queue< T >::pop()
+template< typename T, typename NodeAllocator >
+void kovshikov::Queue< T, NodeAllocator >::pop()
 {
   queue.popFront();
 }
 
-template< typename T >
-T& kovshikov::Queue< T >::front() const
+template< typename T, typename NodeAllocator >
+T& kovshikov::Queue< T, NodeAllocator >::front() const
 {
   return queue.front();
 }
 
-template< typename T >
-T& kovshikov::Queue< T >::back() const
+template< typename T, typename NodeAllocator >
+T& kovshikov::Queue< T, NodeAllocator >::back() const
 {
   return queue.back();
 }
 
-template< typename T >
-size_t kovshikov::Queue< T >::getSize() const
+template< typename T, typename NodeAllocator >
+size_t kovshikov::Queue< T, NodeAllocator >::getSize() const
 {
   size_t size = 0;
-  typename DoubleList< T >::Iterator start = queue.begin();
-  typename DoubleList< T >::Iterator finish = queue.end();
+  typename DoubleList< T, NodeAllocator >::Iterator start = queue.begin();
+  typename DoubleList< T, NodeAllocator >::Iterator finish = queue.end();
   while(start != finish)
   {
     size += 1;
@@ -77,10 +79,16 @@ size_t kovshikov::Queue< T >::getSize() const
   return size;
 }
 
-template< typename T >
-bool kovshikov::Queue< T >::isEmpty() const noexcept
+template< typename T, typename NodeAllocator >
+bool kovshikov::Queue< T, NodeAllocator >::isEmpty() const noexcept
 {
   return queue.empty();
 }
 
+template< typename T, typename NodeAllocator >
+const NodeAllocator& kovshikov::Queue< T, NodeAllocator >::getAllocator() const noexcept
+{
+  return queue.getAllocator();
+}
+
 #endif
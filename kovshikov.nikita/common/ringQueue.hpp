@@ -0,0 +1,197 @@
+#ifndef RINGQUEUE_HPP
+#define RINGQUEUE_HPP
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace kovshikov
+{
+  template< typename T >
+  class RingQueue
+  {
+  public:
+    RingQueue(): data_(nullptr), capacity_(0), head_(0), size_(0) {};
+    RingQueue(const RingQueue< T >& q);
+    RingQueue(RingQueue< T >&& q) noexcept;
+    ~RingQueue();
+
+    RingQueue< T >& operator=(const RingQueue< T >& q);
+    RingQueue< T >& operator=(RingQueue< T >&& q) noexcept;
+
+    void push(const T& val);
+    void pop();
+
+    T& front() const;
+    T& back() const;
+
+    size_t getSize() const;
+    bool isEmpty() const noexcept;
+
+    void reserve(size_t capacity);
+    void swap(RingQueue< T >& q) noexcept;
+  private:
+    T* data_;
+    size_t capacity_;
+    size_t head_;
+    size_t size_;
+
+    size_t position(size_t i) const noexcept;
+    void clear() noexcept;
+  };
+}
+
+template< typename T >
+kovshikov::RingQueue< T >::RingQueue(const RingQueue< T >& q):
+  RingQueue()
+{
+  reserve(q.size_);
+  for(size_t i = 0; i < q.size_; i++)
+  {
+    push(q.data_[q.position(i)]);
+  }
+}
+
+template< typename T >
+kovshikov::RingQueue< T >::RingQueue(RingQueue< T >&& q) noexcept:
+  RingQueue()
+{
+  swap(q);
+}
+
+template< typename T >
+kovshikov::RingQueue< T >::~RingQueue()
+{
+  clear();
+  ::operator delete(data_);
+}
+
+template< typename T >
+kovshikov::RingQueue< T >& kovshikov::RingQueue< T >::operator=(const RingQueue< T >& q)
+{
+  RingQueue< T > newQ(q);
+  swap(newQ);
+  return *this;
+}
+
+template< typename T >
+kovshikov::RingQueue< T >& kovshikov::RingQueue< T >::operator=(RingQueue< T >&& q) noexcept
+{
+  RingQueue< T > newQ(std::move(q));
+  swap(newQ);
+  return *this;
+}
+
+template< typename T >
+size_t kovshikov::RingQueue< T >::position(size_t i) const noexcept
+{
+  size_t pos = head_ + i;
+  return pos < capacity_ ? pos : pos - capacity_;
+}
+
+template< typename T >
+void kovshikov::RingQueue< T >::reserve(size_t capacity)
+{
+  if(capacity <= capacity_)
+  {
+    return;
+  }
+  T* data = static_cast< T* >(::operator new(capacity * sizeof(T)));
+  size_t moved = 0;
+  try
+  {
+    for(; moved < size_; moved++)
+    {
+      new (data + moved) T(std::move_if_noexcept(data_[position(moved)]));
+    }
+  }
+  catch(...)
+  {
+    for(size_t i = 0; i < moved; i++)
+    {
+      data[i].~T();
+    }
+    ::operator delete(data);
+    throw;
+  }
+  size_t size = size_;
+  clear();
+  ::operator delete(data_);
+  data_ = data;
+  capacity_ = capacity;
+  head_ = 0;
+  size_ = size;
+}
+
+template< typename T >
+void kovshikov::RingQueue< T >::push(const T& val)
+{
+  if(size_ == capacity_)
+  {
+    T copy(val);
+    reserve(capacity_ == 0 ? 8 : capacity_ * 2);
+    new (data_ + position(size_)) T(std::move(copy));
+  }
+  else
+  {
+    new (data_ + position(size_)) T(val);
+  }
+  size_ += 1;
+}
+
+template< typename T >
+void kovshikov::RingQueue< T >::pop()
+{
+  if(size_ == 0)
+  {
+    return;
+  }
+  data_[head_].~T();
+  head_ = position(1);
+  size_ -= 1;
+}
+
+template< typename T >
+T& kovshikov::RingQueue< T >::front() const
+{
+  return data_[head_];
+}
+
+template< typename T >
+T& kovshikov::RingQueue< T >::back() const
+{
+  return data_[position(size_ - 1)];
+}
+
+template< typename T >
+size_t kovshikov::RingQueue< T >::getSize() const
+{
+  return size_;
+}
+
+template< typename T >
+bool kovshikov::RingQueue< T >::isEmpty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< typename T >
+void kovshikov::RingQueue< T >::swap(RingQueue< T >& q) noexcept
+{
+  std::swap(data_, q.data_);
+  std::swap(capacity_, q.capacity_);
+  std::swap(head_, q.head_);
+  std::swap(size_, q.size_);
+}
+
+template< typename T >
+void kovshikov::RingQueue< T >::clear() noexcept
+{
+  for(size_t i = 0; i < size_; i++)
+  {
+    data_[position(i)].~T();
+  }
+  head_ = 0;
+  size_ = 0;
+}
+
+#endif
@@ -4,13 +4,13 @@
 
 namespace kovshikov
 {
-  template< typename T >
+  template< typename T, typename NodeAllocator = PoolNodeAllocator< T > >
   class Stack
   {
   public:
     Stack() = default;
-    Stack(const Stack< T >& s);
-    Stack(Stack< T >&& s);
+    Stack(const Stack< T, NodeAllocator >& s);
+    Stack(Stack< T, NodeAllocator >&& s);
     ~Stack() = default;
 
     void push(const T& val);
@@ -19,47 +19,49 @@ namespace kovshikov
 
     size_t getSize() const;
     bool isEmpty() const noexcept;
+
+    const NodeAllocator& getAllocator() const noexcept;
   private:
-    DoubleList< T > stack;
+    DoubleList< T, NodeAllocator > stack;
   };
 }
 
-template< typename T >
-kovshikov::Stack< T >::Stack(const Stack< T >& s)
+template< typename T, typename NodeAllocator >
+kovshikov::Stack< T, NodeAllocator >::Stack(const Stack< T, NodeAllocator >& s)
 {
   stack = s.stack;
 }
 
-template< typename T >
-kovshikov::Stack< T >::Stack(Stack< T >&& s)
+template< typename T, typename NodeAllocator >
+kovshikov::Stack< T, NodeAllocator >::Stack(Stack< T, NodeAllocator >&& s)
 {
   stack = std::move(s.stack);
 }
 
-template< typename T >
-void kovshikov::Stack< T >::push(const T& val)
+template< typename T, typename NodeAllocator >
+void kovshikov::Stack< T, NodeAllocator >::push(const T& val)
 {
   stack.pushBack(val);
 }
 
-template< typename T >
-T& kovshikov::Stack< T >::top()
+template< typename T, typename NodeAllocator >
+T& kovshikov::Stack< T, NodeAllocator >::top()
 {
   return stack.back();
 }
 
-template< typename T >
-void kovshikov::Stack< T >::pop()
+template< typename T, typename NodeAllocator >
+void kovshikov::Stack< T, NodeAllocator >::pop()
 {
   stack.popBack();
 }
 
-template< typename T >
-size_t kovshikov::Stack< T >::getSize() const
+template< typename T, typename NodeAllocator >
+size_t kovshikov::Stack< T, NodeAllocator >::getSize() const
 {
   size_t size = 0;
-  typename DoubleList< T >::Iterator start = stack.begin();
-  typename DoubleList< T >::Iterator finish = stack.end();
+  typename DoubleList< T, NodeAllocator >::Iterator start = stack.begin();
+  typename DoubleList< T, NodeAllocator >::Iterator finish = stack.end();
   while(start != finish)
   {
     size += 1;
@@ -68,10 +70,16 @@ size_t kovshikov::Stack< T >::getSize() const
   return size;
 }
 
-template< typename T >
-bool kovshikov::Stack< T >::isEmpty() const noexcept
+template< typename T, typename NodeAllocator >
+bool kovshikov::Stack< T, NodeAllocator >::isEmpty() const noexcept
 {
   return stack.empty();
 }
 
+template< typename T, typename NodeAllocator >
+const NodeAllocator& kovshikov::Stack< T, NodeAllocator >::getAllocator() const noexcept
+{
+  return stack.getAllocator();
+}
+
 #endif
@@ -0,0 +1,183 @@
+#ifndef VECTORSTACK_HPP
+#define VECTORSTACK_HPP
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace kovshikov
+{
+  template< typename T >
+  class VectorStack
+  {
+  public:
+    VectorStack(): data_(nullptr), capacity_(0), size_(0) {};
+    VectorStack(const VectorStack< T >& s);
+    VectorStack(VectorStack< T >&& s) noexcept;
+    ~VectorStack();
+
+    VectorStack< T >& operator=(const VectorStack< T >& s);
+    VectorStack< T >& operator=(VectorStack< T >&& s) noexcept;
+
+    void push(const T& val);
+    T& top();
+    const T& top() const;
+    void pop();
+
+    size_t getSize() const;
+    bool isEmpty() const noexcept;
+
+    void reserve(size_t capacity);
+    void swap(VectorStack< T >& s) noexcept;
+  private:
+    T* data_;
+    size_t capacity_;
+    size_t size_;
+
+    void clear() noexcept;
+  };
+}
+
+template< typename T >
+kovshikov::VectorStack< T >::VectorStack(const VectorStack< T >& s):
+  VectorStack()
+{
+  reserve(s.size_);
+  for(size_t i = 0; i < s.size_; i++)
+  {
+    push(s.data_[i]);
+  }
+}
+
+template< typename T >
+kovshikov::VectorStack< T >::VectorStack(VectorStack< T >&& s) noexcept:
+  VectorStack()
+{
+  swap(s);
+}
+
+template< typename T >
+kovshikov::VectorStack< T >::~VectorStack()
+{
+  clear();
+  ::operator delete(data_);
+}
+
+template< typename T >
+kovshikov::VectorStack< T >& kovshikov::VectorStack< T >::operator=(const VectorStack< T >& s)
+{
+  VectorStack< T > newS(s);
+  swap(newS);
+  return *this;
+}
+
+template< typename T >
+kovshikov::VectorStack< T >& kovshikov::VectorStack< T >::operator=(VectorStack< T >&& s) noexcept
+{
+  VectorStack< T > newS(std::move(s));
+  swap(newS);
+  return *this;
+}
+
+template< typename T >
+void kovshikov::VectorStack< T >::reserve(size_t capacity)
+{
+  if(capacity <= capacity_)
+  {
+    return;
+  }
+  T* data = static_cast< T* >(::operator new(capacity * sizeof(T)));
+  size_t moved = 0;
+  try
+  {
+    for(; moved < size_; moved++)
+    {
+      new (data + moved) T(std::move_if_noexcept(data_[moved]));
+    }
+  }
+  catch(...)
+  {
+    for(size_t i = 0; i < moved; i++)
+    {
+      data[i].~T();
+    }
+    ::operator delete(data);
+    throw;
+  }
+  size_t size = size_;
+  clear();
+  ::operator delete(data_);
+  data_ = data;
+  capacity_ = capacity;
+  size_ = size;
+}
+
+template< typename T >
+void kovshikov::VectorStack< T >::push(const T& val)
+{
+  if(size_ == capacity_)
+  {
+    T copy(val);
+    reserve(capacity_ == 0 ? 8 : capacity_ * 2);
+    new (data_ + size_) T(std::move(copy));
+  }
+  else
+  {
+    new (data_ + size_) T(val);
+  }
+  size_ += 1;
+}
+
+template< typename T >
+T& kovshikov::VectorStack< T >::top()
+{
+  return data_[size_ - 1];
+}
+
+template< typename T >
+const T& kovshikov::VectorStack< T >::top() const
+{
+  return data_[size_ - 1];
+}
+
+template< typename T >
+void kovshikov::VectorStack< T >::pop()
+{
+  if(size_ == 0)
+  {
+    return;
+  }
+  size_ -= 1;
+  data_[size_].~T();
+}
+
+template< typename T >
+size_t kovshikov::VectorStack< T >::getSize() const
+{
+  return size_;
+}
+
+template< typename T >
+bool kovshikov::VectorStack< T >::isEmpty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< typename T >
+void kovshikov::VectorStack< T >::swap(VectorStack< T >& s) noexcept
+{
+  std::swap(data_, s.data_);
+  std::swap(capacity_, s.capacity_);
+  std::swap(size_, s.size_);
+}
+
+template< typename T >
+void kovshikov::VectorStack< T >::clear() noexcept
+{
+  while(size_ > 0)
+  {
+    size_ -= 1;
+    data_[size_].~T();
+  }
+}
+
+#endif
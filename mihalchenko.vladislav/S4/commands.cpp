@@ -4,6 +4,40 @@
 #include <cctype>
 #include <functional>
 #include <utility>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "outputBuffer.hpp"
+
+namespace
+{
+  using dictionary_t = mihalchenko::AVLTree< long long, std::string >;
+  using vecOfPairs_t = std::vector< std::pair< long long, std::string > >;
+
+  bool compareElemByKey(const dictionary_t::pair_t &iterOfElem1, const dictionary_t::pair_t &iterOfElem2)
+  {
+    return iterOfElem1.first < iterOfElem2.first;
+  }
+
+  bool compareVecElemByKey(const vecOfPairs_t::value_type &iterOfElem1, const vecOfPairs_t::value_type &iterOfElem2)
+  {
+    return iterOfElem1.first < iterOfElem2.first;
+  }
+
+  bool equalVecElemByKey(const vecOfPairs_t::value_type &iterOfElem1, const vecOfPairs_t::value_type &iterOfElem2)
+  {
+    return iterOfElem1.first == iterOfElem2.first;
+  }
+
+  void replaceGlossary(mihalchenko::typeParam &AVLTree, const std::string &name, const vecOfPairs_t &vecOfPairs)
+  {
+    if (AVLTree.find(name) != AVLTree.end())
+    {
+      AVLTree.erase(name);
+    }
+    AVLTree.insert(name, dictionary_t::buildFromSorted(vecOfPairs.cbegin(), vecOfPairs.cend()));
+  }
+}
 
 std::string mihalchenko::resiveString(std::string &inputStr, size_t &pos, bool flag)
 {
@@ -49,55 +83,30 @@ void mihalchenko::print(typeParam &AVLTree)
     return;
   }
 
-  std::cout << (*iterList).first << " ";
-  for (auto it = (*iterList).second.begin(); it != (*iterList).second.end(); ++it)
+  OutputBuffer buffer(std::cout);
+  buffer << (*iterList).first;
+  for (auto it = (*iterList).second.cbegin(); it != (*iterList).second.cend(); ++it)
   {
-    std::cout << (*it).first << " " << (*it).second;
-    if ((++it) == (*iterList).second.end())
-    {
-      std::cout << "\n";
-    }
-    else
-    {
-      std::cout << ' ';
-    }
-    it--;
+    buffer << ' ' << (*it).first << ' ' << (*it).second;
   }
+  buffer << '\n';
 }
 
 void mihalchenko::complement(typeParam &AVLTree)
 {
   std::string nameNewGlossary, nameOneGlossary, nameTwoGlossary;
   std::cin >> nameNewGlossary >> nameOneGlossary >> nameTwoGlossary;
-
-  if (AVLTree.find(nameOneGlossary) == AVLTree.end())
+  if (AVLTree.find(nameOneGlossary) == AVLTree.end() || AVLTree.find(nameTwoGlossary) == AVLTree.end())
   {
     printInvalidCommand(std::cout);
     return;
   }
-  mihalchenko::AVLTree< long long, std::string > compTree{};
-  for (auto it = (*AVLTree.find(nameOneGlossary)).second.begin(); it != (*AVLTree.find(nameOneGlossary)).second.end(); it++)
-  {
-    auto inSecondData = (*AVLTree.find(nameTwoGlossary)).second.find((*it).first);
-    if (inSecondData == (*AVLTree.find(nameTwoGlossary)).second.end())
-    {
-      compTree.insert(*it);
-    }
-  }
-  if (nameOneGlossary == nameNewGlossary)
-  {
-    AVLTree.erase(nameOneGlossary);
-    AVLTree.insert(nameNewGlossary, compTree);
-  }
-  else
-  {
-    AVLTree.insert(nameNewGlossary, compTree);
-  }
-  if (AVLTree.find(nameNewGlossary) != AVLTree.end())
-  {
-    AVLTree.erase(nameNewGlossary);
-  }
-  AVLTree.insert(nameNewGlossary, compTree);
+  const dictionary_t &firstDict = (*AVLTree.find(nameOneGlossary)).second;
+  const dictionary_t &secondDict = (*AVLTree.find(nameTwoGlossary)).second;
+  vecOfPairs_t vecOfPairs;
+  std::set_difference(firstDict.cbegin(), firstDict.cend(), secondDict.cbegin(), secondDict.cend(),
+    std::back_inserter(vecOfPairs), compareElemByKey);
+  replaceGlossary(AVLTree, nameNewGlossary, vecOfPairs);
 }
 
 void mihalchenko::intersect(typeParam &AVLTree)
@@ -109,20 +118,12 @@ void mihalchenko::intersect(typeParam &AVLTree)
     printInvalidCommand(std::cout);
     return;
   }
-  mihalchenko::AVLTree< long long, std::string > dicts{};
-  for (auto it = (*AVLTree.find(nameOneGlossary)).second.begin(); it != (*AVLTree.find(nameOneGlossary)).second.end(); it++)
-  {
-    auto inSecondData = (*AVLTree.find(nameTwoGlossary)).second.find((*it).first);
-    if (inSecondData != (*AVLTree.find(nameTwoGlossary)).second.end())
-    {
-      dicts.insert(*it);
-    }
-  }
-  if (AVLTree.find(nameNewGlossary) != AVLTree.end())
-  {
-    AVLTree.erase(nameNewGlossary);
-  }
-  AVLTree.insert(nameNewGlossary, dicts);
+  const dictionary_t &firstDict = (*AVLTree.find(nameOneGlossary)).second;
+  const dictionary_t &secondDict = (*AVLTree.find(nameTwoGlossary)).second;
+  vecOfPairs_t vecOfPairs;
+  std::set_intersection(firstDict.cbegin(), firstDict.cend(), secondDict.cbegin(), secondDict.cend(),
+    std::back_inserter(vecOfPairs), compareElemByKey);
+  replaceGlossary(AVLTree, nameNewGlossary, vecOfPairs);
 }
 
 void mihalchenko::unionAVL(typeParam &AVLTree)
@@ -134,35 +135,26 @@ void mihalchenko::unionAVL(typeParam &AVLTree)
     printInvalidCommand(std::cout);
     return;
   }
-  mihalchenko::AVLTree< long long, std::string > dicts{};
-  for (auto it = (*AVLTree.find(nameOneGlossary)).second.begin(); it != (*AVLTree.find(nameOneGlossary)).second.end(); it++)
-  {
-    dicts.insert(*it);
-  }
-  for (auto it = (*AVLTree.find(nameTwoGlossary)).second.begin(); it != (*AVLTree.find(nameTwoGlossary)).second.end(); it++)
-  {
-    if (dicts.find((*it).first) == dicts.end())
-    {
-      dicts.insert(*it);
-    }
-  }
-  if (AVLTree.find(nameNewGlossary) != AVLTree.end())
-  {
-    AVLTree.erase(nameNewGlossary);
-  }
-  AVLTree.insert(nameNewGlossary, dicts);
+  const dictionary_t &firstDict = (*AVLTree.find(nameOneGlossary)).second;
+  const dictionary_t &secondDict = (*AVLTree.find(nameTwoGlossary)).second;
+  vecOfPairs_t vecOfPairs;
+  std::set_union(firstDict.cbegin(), firstDict.cend(), secondDict.cbegin(), secondDict.cend(),
+    std::back_inserter(vecOfPairs), compareElemByKey);
+  replaceGlossary(AVLTree, nameNewGlossary, vecOfPairs);
 }
 
 void mihalchenko::insertDataToTree(typeParam &TreeAndLeaves, std::string &inputStr)
 {
-  AVLTree< long long, std::string > branchAndLeaves{};
+  vecOfPairs_t vecOfPairs;
   size_t pos = 0;
   std::string nameGlossary = resiveString(inputStr, pos, true);
   while (pos < inputStr.length())
   {
     long long key = std::stoll(resiveString(inputStr, pos, false));
     std::string value = resiveString(inputStr, pos, true);
-    branchAndLeaves.insert(key, value);
+    vecOfPairs.push_back({key, value});
   }
-  TreeAndLeaves.insert(nameGlossary, branchAndLeaves);
+  std::stable_sort(vecOfPairs.begin(), vecOfPairs.end(), compareVecElemByKey);
+  vecOfPairs.erase(std::unique(vecOfPairs.begin(), vecOfPairs.end(), equalVecElemByKey), vecOfPairs.end());
+  TreeAndLeaves.insert(nameGlossary, dictionary_t::buildFromSorted(vecOfPairs.cbegin(), vecOfPairs.cend()));
 }
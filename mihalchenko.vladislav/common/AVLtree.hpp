@@ -1,5 +1,6 @@
 #ifndef AVLTREE_HPP
 #define AVLTREE_HPP
+#include <algorithm>
 #include <utility>
 #include <iterator>
 #include <initializer_list>
@@ -31,6 +32,9 @@ namespace mihalchenko
 
     AVLTree &operator=(AVLTree other);
 
+    template < class ForwardIt >
+    static AVLTree buildFromSorted(ForwardIt start, ForwardIt stop);
+
     void insert(const Key &key, const Value &value);
     void insert(const pair_t &pairKeyVal);
     bool empty() const noexcept;
@@ -52,6 +56,11 @@ namespace mihalchenko
     Iterator begin() noexcept;
     Iterator end() noexcept;
 
+    size_t rank(const Key &key) const;
+    ConstIterator select(size_t index) const;
+    size_t countInRange(const Key &lower, const Key &upper) const;
+    std::pair< ConstIterator, ConstIterator > range(const Key &lower, const Key &upper) const;
+
     template< typename F >
     F constTraverseLR(F stackFunc) const;
     template< typename F >
@@ -75,6 +84,7 @@ namespace mihalchenko
     private:
       pair_t pairOfKeyVal_;
       int height_;
+      size_t count_;
       Node *left_;
       Node *right_;
       Node *previous_;
@@ -84,6 +94,13 @@ namespace mihalchenko
     Iterator findNode(const Key &key, Node *node);
     ConstIterator findNode(const Key &key, Node *node) const;
     Node *eraseNode(const Key &key);
+    void replaceNode(Node *node, Node *child);
+
+    size_t getCount(const Node *node) const;
+    void updateCount(Node *node);
+    size_t countNotGreater(const Key &key) const;
+    Node *findLowerBound(const Key &key) const;
+    Node *findUpperBound(const Key &key) const;
 
     int calcHeight(Node *node);
     void balancingTree(Node *overweight);
@@ -97,6 +114,8 @@ namespace mihalchenko
     const Node *getRoot() const;
 
     Node *copyTree(Node *node, Node *previous);
+    template < class ForwardIt >
+    Node *buildSubtree(ForwardIt &start, size_t count);
     void clear(Node *node);
 
     Node *root_;
@@ -161,6 +180,7 @@ template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::Node::Node(Key key, Value data, int height, Node *left, Node *right, Node *previous) :
   pairOfKeyVal_(std::make_pair(key, data)),
   height_(height),
+  count_(1),
   left_(left),
   right_(right),
   previous_(previous)
@@ -208,6 +228,10 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::Node
       node = node->right_;
     }
   }
+  for (Node *temp = newNode->previous_; temp; temp = temp->previous_)
+  {
+    temp->count_++;
+  }
   return newNode;
 }
 
@@ -216,91 +240,74 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::Node
   *mihalchenko::AVLTree< Key, Value, Compare >::eraseNode(const Key &key)
 {
   Node *deletedNode = find(key).constIter_.node_;
-  Node *prevDelNode = deletedNode->previous_;
-  Node *workerNode = deletedNode;
-  Node *firstRightNode = nullptr;
+  Node *changedNode = deletedNode->previous_;
   Node *tempNode = nullptr;
-  if ((deletedNode->left_ == nullptr) && (deletedNode->right_ == nullptr))
+  if ((deletedNode->left_ == nullptr) || (deletedNode->right_ == nullptr))
   {
-    if (prevDelNode)
-    {
-      if (prevDelNode->left_)
-      {
-        (prevDelNode->left_ == deletedNode) ? prevDelNode->left_ = nullptr : prevDelNode->right_ = nullptr;
-      }
-      else
-      {
-        (prevDelNode->right_ == deletedNode) ? prevDelNode->right_ = nullptr : prevDelNode->left_ = nullptr;
-      }
-    }
-    else
-    {
-      root_ = nullptr;
-    }
-    tempNode = deletedNode;
-    delete deletedNode;
+    tempNode = (deletedNode->left_) ? deletedNode->left_ : deletedNode->right_;
   }
-  else if (!(deletedNode->left_ == nullptr) && !(deletedNode->right_ == nullptr))
+  else
   {
-    workerNode = deletedNode->right_;
-    while (workerNode->left_)
+    tempNode = deletedNode->right_;
+    while (tempNode->left_)
     {
-      workerNode = workerNode->left_;
+      tempNode = tempNode->left_;
     }
-    firstRightNode = workerNode;
-
-    workerNode = deletedNode->left_;
-    workerNode->previous_ = firstRightNode;
-    firstRightNode->left_ = workerNode;
-    if (deletedNode == root_)
+    changedNode = tempNode;
+    if (tempNode->previous_ != deletedNode)
     {
-      root_ = firstRightNode;
+      changedNode = tempNode->previous_;
+      replaceNode(tempNode, tempNode->right_);
+      tempNode->right_ = deletedNode->right_;
+      tempNode->right_->previous_ = tempNode;
     }
-    tempNode = deletedNode;
-    delete deletedNode;
+    tempNode->left_ = deletedNode->left_;
+    tempNode->left_->previous_ = tempNode;
   }
-  else
+  replaceNode(deletedNode, tempNode);
+  for (Node *temp = changedNode; temp; temp = temp->previous_)
   {
-    if (prevDelNode)
-    {
-      if (prevDelNode->left_ == deletedNode)
-      {
-        if (!(deletedNode->left_ = nullptr))
-        {
-          deletedNode->left_->previous_ = prevDelNode;
-          prevDelNode->left_ = deletedNode->left_;
-        }
-        else
-        {
-          deletedNode->right_->previous_ = prevDelNode;
-          prevDelNode->left_ = deletedNode->right_;
-        }
-      }
-      else
-      {
-        if (!(deletedNode->right_ = nullptr))
-        {
-          deletedNode->left_->previous_ = prevDelNode;
-          prevDelNode->right_ = deletedNode->left_;
-        }
-        else
-        {
-          deletedNode->right_->previous_ = prevDelNode;
-          prevDelNode->right_ = deletedNode->right_;
-        }
-      }
-    }
-    else
-    {
-      (deletedNode->right_) ? root_ = deletedNode->right_ : root_ = deletedNode->left_;
-    }
-    tempNode = deletedNode;
-    delete deletedNode;
+    updateCount(temp);
   }
+  delete deletedNode;
   size_--;
   return tempNode;
 }
 
+template < typename Key, typename Value, typename Compare >
+void mihalchenko::AVLTree< Key, Value, Compare >::replaceNode(Node *node, Node *child)
+{
+  Node *prevNode = node->previous_;
+  if (child)
+  {
+    child->previous_ = prevNode;
+  }
+  if (!prevNode)
+  {
+    root_ = child;
+  }
+  else if (prevNode->left_ == node)
+  {
+    prevNode->left_ = child;
+  }
+  else
+  {
+    prevNode->right_ = child;
+  }
+}
+
+template < typename Key, typename Value, typename Compare >
+size_t mihalchenko::AVLTree< Key, Value, Compare >::getCount(const Node *node) const
+{
+  return (node) ? node->count_ : 0;
+}
+
+template < typename Key, typename Value, typename Compare >
+void mihalchenko::AVLTree< Key, Value, Compare >::updateCount(Node *node)
+{
+  node->count_ = getCount(node->left_) + getCount(node->right_) + 1;
+}
+
 template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::AVLTree()
 {
@@ -348,7 +355,10 @@ mihalchenko::AVLTree< Key, Value, Compare >::AVLTree(std::initializer_list< pair
 template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::AVLTree(const AVLTree &copy)
 {
-  root_ = copyTree(copy.root_, nullptr);
+  root_ = nullptr;
+  size_ = std::distance(copy.cbegin(), copy.cend());
+  ConstIterator it = copy.cbegin();
+  root_ = buildSubtree(it, size_);
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -519,9 +529,9 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator
     return cend();
   }
   Node *temp = root_;
-  while (temp->left != nullptr)
+  while (temp->left_ != nullptr)
   {
-    temp = temp->left;
+    temp = temp->left_;
   }
   return ConstIterator(temp, root_);
 }
@@ -533,6 +543,141 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator
   return ConstIterator(nullptr, root_);
 }
 
+template < typename Key, typename Value, typename Compare >
+size_t mihalchenko::AVLTree< Key, Value, Compare >::rank(const Key &key) const
+{
+  Compare compare;
+  size_t result = 0;
+  Node *node = root_;
+  while (node)
+  {
+    if (compare(node->pairOfKeyVal_.first, key))
+    {
+      result += getCount(node->left_) + 1;
+      node = node->right_;
+    }
+    else
+    {
+      node = node->left_;
+    }
+  }
+  return result;
+}
+
+template < typename Key, typename Value, typename Compare >
+typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator
+  mihalchenko::AVLTree< Key, Value, Compare >::select(size_t index) const
+{
+  Node *node = (index < getCount(root_)) ? root_ : nullptr;
+  while (node)
+  {
+    size_t leftCount = getCount(node->left_);
+    if (index < leftCount)
+    {
+      node = node->left_;
+    }
+    else if (index > leftCount)
+    {
+      index -= leftCount + 1;
+      node = node->right_;
+    }
+    else
+    {
+      break;
+    }
+  }
+  return ConstIterator(node, root_);
+}
+
+template < typename Key, typename Value, typename Compare >
+size_t mihalchenko::AVLTree< Key, Value, Compare >::countInRange(const Key &lower, const Key &upper) const
+{
+  Compare compare;
+  if (compare(upper, lower))
+  {
+    return 0;
+  }
+  return countNotGreater(upper) - rank(lower);
+}
+
+template < typename Key, typename Value, typename Compare >
+std::pair< typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator,
+  typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator >
+  mihalchenko::AVLTree< Key, Value, Compare >::range(const Key &lower, const Key &upper) const
+{
+  Compare compare;
+  if (compare(upper, lower))
+  {
+    return std::make_pair(cend(), cend());
+  }
+  return std::make_pair(ConstIterator(findLowerBound(lower), root_), ConstIterator(findUpperBound(upper), root_));
+}
+
+template < typename Key, typename Value, typename Compare >
+size_t mihalchenko::AVLTree< Key, Value, Compare >::countNotGreater(const Key &key) const
+{
+  Compare compare;
+  size_t result = 0;
+  Node *node = root_;
+  while (node)
+  {
+    if (!compare(key, node->pairOfKeyVal_.first))
+    {
+      result += getCount(node->left_) + 1;
+      node = node->right_;
+    }
+    else
+    {
+      node = node->left_;
+    }
+  }
+  return result;
+}
+
+template < typename Key, typename Value, typename Compare >
+typename mihalchenko::AVLTree< Key, Value, Compare >::Node
+  *mihalchenko::AVLTree< Key, Value, Compare >::findLowerBound(const Key &key) const
+{
+  Compare compare;
+  Node *result = nullptr;
+  Node *node = root_;
+  while (node)
+  {
+    if (compare(node->pairOfKeyVal_.first, key))
+    {
+      node = node->right_;
+    }
+    else
+    {
+      result = node;
+      node = node->left_;
+    }
+  }
+  return result;
+}
+
+template < typename Key, typename Value, typename Compare >
+typename mihalchenko::AVLTree< Key, Value, Compare >::Node
+  *mihalchenko::AVLTree< Key, Value, Compare >::findUpperBound(const Key &key) const
+{
+  Compare compare;
+  Node *result = nullptr;
+  Node *node = root_;
+  while (node)
+  {
+    if (compare(key, node->pairOfKeyVal_.first))
+    {
+      result = node;
+      node = node->left_;
+    }
+    else
+    {
+      node = node->right_;
+    }
+  }
+  return result;
+}
+
 template < typename Key, typename Value, typename Compare >
 int mihalchenko::AVLTree< Key, Value, Compare >::calcHeight(Node *node)
 {
@@ -603,6 +748,8 @@ void mihalchenko::AVLTree< Key, Value, Compare >::leftSpin(Node *nodeP)
   {
     root_ = nodeQ;
   }
+  updateCount(nodeP);
+  updateCount(nodeQ);
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -630,6 +777,8 @@ void mihalchenko::AVLTree< Key, Value, Compare >::rightSpin(Node *nodeP)
   {
     root_ = nodeQ;
   }
+  updateCount(nodeP);
+  updateCount(nodeQ);
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -685,11 +834,61 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::Node
     return nullptr;
   }
   Node *newnode = new Node(node->pairOfKeyVal_.first, node->pairOfKeyVal_.second, node->height_, nullptr, nullptr, previous);
+  newnode->count_ = node->count_;
   newnode->left_ = copyTree(node->left_, newnode);
   newnode->right_ = copyTree(node->right_, newnode);
   return newnode;
 }
 
+template < typename Key, typename Value, typename Compare >
+template < class ForwardIt >
+typename mihalchenko::AVLTree< Key, Value, Compare >::AVLTree
+  mihalchenko::AVLTree< Key, Value, Compare >::buildFromSorted(ForwardIt start, ForwardIt stop)
+{
+  AVLTree tree;
+  tree.size_ = std::distance(start, stop);
+  tree.root_ = tree.buildSubtree(start, tree.size_);
+  return tree;
+}
+
+template < typename Key, typename Value, typename Compare >
+template < class ForwardIt >
+typename mihalchenko::AVLTree< Key, Value, Compare >::Node
+  *mihalchenko::AVLTree< Key, Value, Compare >::buildSubtree(ForwardIt &start, size_t count)
+{
+  if (count == 0)
+  {
+    return nullptr;
+  }
+  Node *left = buildSubtree(start, count / 2);
+  Node *node = nullptr;
+  Node *right = nullptr;
+  try
+  {
+    node = new Node(start->first, start->second, 0, left, nullptr, nullptr);
+    ++start;
+    right = buildSubtree(start, count - count / 2 - 1);
+  }
+  catch (...)
+  {
+    clear(left);
+    delete node;
+    throw;
+  }
+  node->right_ = right;
+  if (left)
+  {
+    left->previous_ = node;
+  }
+  if (right)
+  {
+    right->previous_ = node;
+  }
+  node->height_ = std::max(getHeight(left), getHeight(right)) + 1;
+  node->count_ = count;
+  return node;
+}
+
 template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator::ConstIterator()
 {
@@ -0,0 +1,138 @@
+#ifndef OUTPUTBUFFER_HPP
+#define OUTPUTBUFFER_HPP
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace mihalchenko
+{
+  class OutputBuffer
+  {
+  public:
+    explicit OutputBuffer(std::ostream &out, size_t capacity = 65536);
+    OutputBuffer(const OutputBuffer &) = delete;
+    ~OutputBuffer();
+
+    OutputBuffer &operator=(const OutputBuffer &) = delete;
+
+    OutputBuffer &operator<<(char symbol);
+    OutputBuffer &operator<<(const char *str);
+    OutputBuffer &operator<<(const std::string &str);
+    template < typename Integer >
+    typename std::enable_if< std::is_integral< Integer >::value, OutputBuffer & >::type operator<<(Integer value);
+
+    void write(const char *data, size_t length);
+    void flush();
+
+  private:
+    std::ostream &out_;
+    std::string buffer_;
+    size_t capacity_;
+
+    template < typename Integer >
+    void writeInteger(Integer value, std::true_type);
+    template < typename Integer >
+    void writeInteger(Integer value, std::false_type);
+    void writeUnsigned(unsigned long long value, bool isNegative);
+  };
+}
+
+inline mihalchenko::OutputBuffer::OutputBuffer(std::ostream &out, size_t capacity):
+  out_(out),
+  buffer_(),
+  capacity_(capacity)
+{}
+
+inline mihalchenko::OutputBuffer::~OutputBuffer()
+{
+  try
+  {
+    flush();
+  }
+  catch (...)
+  {}
+}
+
+inline mihalchenko::OutputBuffer &mihalchenko::OutputBuffer::operator<<(char symbol)
+{
+  buffer_.push_back(symbol);
+  if (buffer_.size() >= capacity_)
+  {
+    flush();
+  }
+  return *this;
+}
+
+inline mihalchenko::OutputBuffer &mihalchenko::OutputBuffer::operator<<(const char *str)
+{
+  write(str, std::strlen(str));
+  return *this;
+}
+
+inline mihalchenko::OutputBuffer &mihalchenko::OutputBuffer::operator<<(const std::string &str)
+{
+  write(str.data(), str.length());
+  return *this;
+}
+
+template < typename Integer >
+typename std::enable_if< std::is_integral< Integer >::value, mihalchenko::OutputBuffer & >::type
+  mihalchenko::OutputBuffer::operator<<(Integer value)
+{
+  writeInteger(value, std::is_signed< Integer >());
+  return *this;
+}
+
+inline void mihalchenko::OutputBuffer::write(const char *data, size_t length)
+{
+  if (buffer_.size() + length > capacity_)
+  {
+    flush();
+    if (length >= capacity_)
+    {
+      out_.write(data, length);
+      return;
+    }
+  }
+  buffer_.append(data, length);
+}
+
+inline void mihalchenko::OutputBuffer::flush()
+{
+  out_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+template < typename Integer >
+void mihalchenko::OutputBuffer::writeInteger(Integer value, std::true_type)
+{
+  unsigned long long magnitude = static_cast< unsigned long long >(value);
+  writeUnsigned((value < 0) ? 0 - magnitude : magnitude, value < 0);
+}
+
+template < typename Integer >
+void mihalchenko::OutputBuffer::writeInteger(Integer value, std::false_type)
+{
+  writeUnsigned(value, false);
+}
+
+inline void mihalchenko::OutputBuffer::writeUnsigned(unsigned long long value, bool isNegative)
+{
+  char digits[24];
+  char *begin = digits + sizeof(digits);
+  do
+  {
+    *--begin = static_cast< char >('0' + value % 10);
+    value /= 10;
+  }
+  while (value != 0);
+  if (isNegative)
+  {
+    *--begin = '-';
+  }
+  write(begin, digits + sizeof(digits) - begin);
+}
+
+#endif
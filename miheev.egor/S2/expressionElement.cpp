@@ -1,77 +1,51 @@
 #include "expressionElement.hpp"
 
 miheev::element_t::element_t():
-  type("none")
+  type(elementType::none),
+  payload(0)
 {}
 
-miheev::element_t::element_t(const element_t& rhs)
+miheev::Operand miheev::element_t::getOperand() const
 {
-  *this = rhs;
+  return Operand(payload);
 }
-
-const miheev::Operand& miheev::element_t::getOperand() const
-{
-  return operand;
-}
-const miheev::Operation& miheev::element_t::getOperation() const
+miheev::Operation miheev::element_t::getOperation() const
 {
-  return operation;
+  return Operation(static_cast< char >(payload));
 }
-const miheev::Parenthesis& miheev::element_t::getParenthesis() const
+miheev::Parenthesis miheev::element_t::getParenthesis() const
 {
-  return parenthesis;
+  return Parenthesis{static_cast< char >(payload)};
 }
-const std::string miheev::element_t::getType() const
+miheev::elementType miheev::element_t::getType() const
 {
   return type;
 }
 
 void miheev::element_t::setOperand(const miheev::Operand& rhs)
 {
-  operand = rhs;
-  type = "operand";
+  setOperand(rhs.getValue());
 }
 void miheev::element_t::setOperand(long long value)
 {
-  operand.setValue(value);
-  type = "operand";
+  payload = value;
+  type = elementType::operand;
 }
 void miheev::element_t::setOperation(const miheev::Operation& rhs)
 {
-  operation = rhs;
-  type = "operation";
+  setOperation(rhs.getOperation());
 }
 void miheev::element_t::setOperation(char op)
 {
-  operation.setOperation(op);
-  type = "operation";
+  payload = op;
+  type = elementType::operation;
 }
 void miheev::element_t::setParenthesis(const miheev::Parenthesis& rhs)
 {
-  parenthesis = rhs;
-  type = "parenthesis";
+  setParenthesis(rhs.parenthesis);
 }
 void miheev::element_t::setParenthesis(char par)
 {
-  parenthesis.parenthesis = par;
-  type = "parenthesis";
-}
-
-
-miheev::element_t& miheev::element_t::operator=(const element_t& rhs)
-{
-  type = rhs.type;
-  if (rhs.type == "operation")
-  {
-    operation = Operation(rhs.operation.getOperation());
-  }
-  else if (rhs.type == "operand")
-  {
-    operand = Operand(rhs.operand.getValue());
-  }
-  else if (rhs.type == "parenthesis")
-  {
-    parenthesis = Parenthesis{rhs.parenthesis.parenthesis};
-  }
-  return *this;
+  payload = par;
+  type = elementType::parenthesis;
 }
@@ -3,21 +3,28 @@
 
 #include "operations.hpp"
 #include "operands.hpp"
-#include "string"
 
 namespace miheev
 {
+  enum class elementType: char
+  {
+    none,
+    operand,
+    operation,
+    parenthesis
+  };
+
   struct element_t
   {
   public:
     element_t();
-    element_t(const element_t&);
-    element_t& operator=(const element_t&);
+    element_t(const element_t&) = default;
+    element_t& operator=(const element_t&) = default;
 
-    const Operand& getOperand() const;
-    const Operation& getOperation() const;
-    const Parenthesis& getParenthesis() const;
-    const std::string getType() const;
+    Operand getOperand() const;
+    Operation getOperation() const;
+    Parenthesis getParenthesis() const;
+    elementType getType() const;
 
     void setOperand(const Operand& rhs);
     void setOperand(long long);
@@ -27,10 +34,8 @@ namespace miheev
     void setParenthesis(char);
 
   private:
-    Operand operand;
-    Operation operation;
-    Parenthesis parenthesis;
-    std::string type;
+    elementType type;
+    long long payload;
   };
 }
 
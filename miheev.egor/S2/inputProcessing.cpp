@@ -1,4 +1,6 @@
 #include "inputProcessing.hpp"
+#include <stdexcept>
+#include <string>
 #include "expressionElement.hpp"
 #include "postfixElement.hpp"
 #include "queue.hpp"
@@ -10,7 +12,6 @@ namespace miheev
   element_t getElement(std::string&);
   Queue< postfix_t > lineToPosfix(std::string line);
   long long calcLine(std::string);
-  void printTypes(miheev::Queue< element_t >);
 }
 
 std::string miheev::getSymbol(std::string& s)
@@ -62,7 +63,7 @@ bool isOpeningParenthesisOnTop(const miheev::Stack< miheev::element_t >& stack)
   {
     return false;
   }
-  bool parenthesisOnTop = stack.top().getType() != "parenthesis";
+  bool parenthesisOnTop = stack.top().getType() != miheev::elementType::parenthesis;
   if (parenthesisOnTop)
   {
     return false;
@@ -81,7 +82,7 @@ bool shouldPushOpToStack(const miheev::Stack< miheev::element_t >& stack, const
   {
     return true;
   }
-  bool operationOnTop = stack.top().getType() != "operation";
+  bool operationOnTop = stack.top().getType() != miheev::elementType::operation;
   if (operationOnTop)
   {
     return true;
@@ -102,7 +103,7 @@ miheev::Queue< miheev::postfix_t > miheev::lineToPosfix(std::string line)
   while (line != "")
   {
     current = getElement(line);
-    if (current.getType() == "parenthesis")
+    if (current.getType() == elementType::parenthesis)
     {
       if (current.getParenthesis().parenthesis == '(')
       {
@@ -119,12 +120,12 @@ miheev::Queue< miheev::postfix_t > miheev::lineToPosfix(std::string line)
         stack.pop();
       }
     }
-    else if (current.getType() == "operand")
+    else if (current.getType() == elementType::operand)
     {
       miheev::postfix_t temp(current);
       queue.push(temp);
     }
-    else if (current.getType() == "operation")
+    else if (current.getType() == elementType::operation)
     {
       while (!shouldPushOpToStack(stack, current))
       {
@@ -144,16 +145,6 @@ miheev::Queue< miheev::postfix_t > miheev::lineToPosfix(std::string line)
   return queue;
 }
 
-void miheev::printTypes(miheev::Queue< miheev::element_t > q)
-{
-  while (!q.empty())
-  {
-    std::cout << q.front().getType() << ' ';
-    q.pop();
-  }
-  std::cout << '\n';
-}
-
 long long miheev::calcLine(std::string line)
 {
   miheev::Stack< Operand > stack;
@@ -162,11 +153,11 @@ long long miheev::calcLine(std::string line)
   {
     miheev::postfix_t current = postfix.front();
     postfix.pop();
-    if (current.getType() == "operand")
+    if (current.getType() == elementType::operand)
     {
       stack.push(current.getOperand());
     }
-    else if(current.getType() == "operation")
+    else if(current.getType() == elementType::operation)
     {
       Operand rhs = stack.top();
       stack.pop();
@@ -1,64 +1,50 @@
 #include "postfixElement.hpp"
 
 miheev::postfix_t::postfix_t():
-  type("none")
+  type(elementType::none),
+  payload(0)
 {}
 
-miheev::postfix_t::postfix_t(const miheev::postfix_t& rhs)
+miheev::postfix_t::postfix_t(const miheev::element_t& rhs):
+  postfix_t()
 {
-  *this = rhs;
-}
-
-miheev::postfix_t::postfix_t(const miheev::element_t& rhs)
-{
-  type = rhs.getType();
-  if (rhs.getType() == "operand")
-  {
-    operand = rhs.getOperand();
-  }
-  else if (rhs.getType() == "operation")
+  if (rhs.getType() == elementType::operand)
   {
-    operation = rhs.getOperation();
+    setOperand(rhs.getOperand());
   }
-}
-
-miheev::postfix_t& miheev::postfix_t::operator=(const miheev::postfix_t& rhs)
-{
-  type = rhs.type;
-  if (rhs.type == "operand")
+  else if (rhs.getType() == elementType::operation)
   {
-    operand = rhs.operand;
+    setOperation(rhs.getOperation());
   }
-  else if (rhs.type == "operation")
+  else
   {
-    operation = rhs.operation;
+    type = rhs.getType();
   }
-  return *this;
 }
 
-const miheev::Operand& miheev::postfix_t::getOperand() const
+miheev::Operand miheev::postfix_t::getOperand() const
 {
-  return operand;
+  return Operand(payload);
 }
 
-const miheev::Operation& miheev::postfix_t::getOperation() const
+miheev::Operation miheev::postfix_t::getOperation() const
 {
-  return operation;
+  return Operation(static_cast< char >(payload));
 }
 
-const std::string miheev::postfix_t::getType() const
+miheev::elementType miheev::postfix_t::getType() const
 {
   return type;
 }
 
 void miheev::postfix_t::setOperand(const miheev::Operand& rhs)
 {
-  operand.setValue(rhs.getValue());
-  type = "operand";
+  payload = rhs.getValue();
+  type = elementType::operand;
 }
 
 void miheev::postfix_t::setOperation(const miheev::Operation& rhs)
 {
-  operation.setOperation(rhs.getOperation());
-  type = "operation";
+  payload = rhs.getOperation();
+  type = elementType::operation;
 }
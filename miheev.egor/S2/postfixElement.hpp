@@ -9,21 +9,20 @@ namespace miheev
   {
   public:
     postfix_t();
-    postfix_t(const postfix_t&);
+    postfix_t(const postfix_t&) = default;
     explicit postfix_t(const element_t&);
-    postfix_t& operator=(const postfix_t&);
+    postfix_t& operator=(const postfix_t&) = default;
 
-    const Operand& getOperand() const;
-    const Operation& getOperation() const;
-    const std::string getType() const;
+    Operand getOperand() const;
+    Operation getOperation() const;
+    elementType getType() const;
 
     void setOperand(const Operand& rhs);
     void setOperation(const Operation& rhs);
 
   private:
-    Operand operand;
-    Operation operation;
-    std::string type;
+    elementType type;
+    long long payload;
   };
 }
 
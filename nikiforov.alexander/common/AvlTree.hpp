@@ -47,6 +47,11 @@ namespace nikiforov
     Iterator find(const Key& key);
     std::pair< Iterator, Iterator > equalRange(const Key& key);
 
+    size_t rank(const Key& key) const;
+    ConstIterator select(size_t index) const;
+    size_t countInRange(const Key& lower, const Key& upper) const;
+    std::pair< ConstIterator, ConstIterator > range(const Key& lower, const Key& upper) const;
+
     template< typename F >
     F traverse_lnr(F f) const;
 
@@ -64,12 +69,14 @@ namespace nikiforov
       Node* left;
       Node* parent;
       keyValue_t data;
+      size_t count;
 
       Node(keyValue_t data) :
         right(nullptr),
         left(nullptr),
         parent(nullptr),
-        data(data)
+        data(data),
+        count(1)
       {}
     };
 
@@ -84,6 +91,10 @@ namespace nikiforov
 
     Node* insertData(Node* pNode, const Key& key, const Value& value);
     size_t countSize(Node* pNode) const;
+    void updateSize(Node* pNode);
+    size_t countNotGreater(const Key& key) const;
+    Node* lowerBound(const Key& key) const;
+    Node* upperBound(const Key& key) const;
     size_t getHeight(Node* pNode);
     int heightDiff(Node* pNode);
     Node* balance(Node* pNode);
@@ -825,6 +836,131 @@ pairIters<Key, Value, Compare> nikiforov::AvlTree<Key, Value, Compare>::equalRan
   }
 }
 
+template< typename Key, typename Value, typename Compare >
+size_t nikiforov::AvlTree< Key, Value, Compare >::rank(const Key& key) const
+{
+  size_t result = 0;
+  Node* actual = pRoot;
+  while (actual)
+  {
+    if (cmp(actual->data.first, key))
+    {
+      result += countSize(actual->left) + 1;
+      actual = actual->right;
+    }
+    else
+    {
+      actual = actual->left;
+    }
+  }
+  return result;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename nikiforov::AvlTree< Key, Value, Compare >::ConstIterator nikiforov::AvlTree< Key, Value, Compare >::select(size_t index) const
+{
+  Node* actual = index < countSize(pRoot) ? pRoot : nullptr;
+  while (actual)
+  {
+    size_t leftSize = countSize(actual->left);
+    if (index < leftSize)
+    {
+      actual = actual->left;
+    }
+    else if (index > leftSize)
+    {
+      index -= leftSize + 1;
+      actual = actual->right;
+    }
+    else
+    {
+      break;
+    }
+  }
+  return ConstIterator(actual);
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t nikiforov::AvlTree< Key, Value, Compare >::countInRange(const Key& lower, const Key& upper) const
+{
+  if (cmp(upper, lower))
+  {
+    return 0;
+  }
+  return countNotGreater(upper) - rank(lower);
+}
+
+template< typename Key, typename Value, typename Compare >
+std::pair< typename nikiforov::AvlTree< Key, Value, Compare >::ConstIterator, typename nikiforov::AvlTree< Key, Value, Compare >::ConstIterator >
+nikiforov::AvlTree< Key, Value, Compare >::range(const Key& lower, const Key& upper) const
+{
+  if (cmp(upper, lower))
+  {
+    return std::make_pair(cend(), cend());
+  }
+  return std::make_pair(ConstIterator(lowerBound(lower)), ConstIterator(upperBound(upper)));
+}
+
+template< typename Key, typename Value, typename Compare >
+size_t nikiforov::AvlTree< Key, Value, Compare >::countNotGreater(const Key& key) const
+{
+  size_t result = 0;
+  Node* actual = pRoot;
+  while (actual)
+  {
+    if (!cmp(key, actual->data.first))
+    {
+      result += countSize(actual->left) + 1;
+      actual = actual->right;
+    }
+    else
+    {
+      actual = actual->left;
+    }
+  }
+  return result;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree< Key, Value, Compare >::lowerBound(const Key& key) const
+{
+  Node* result = nullptr;
+  Node* actual = pRoot;
+  while (actual)
+  {
+    if (cmp(actual->data.first, key))
+    {
+      actual = actual->right;
+    }
+    else
+    {
+      result = actual;
+      actual = actual->left;
+    }
+  }
+  return result;
+}
+
+template< typename Key, typename Value, typename Compare >
+typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree< Key, Value, Compare >::upperBound(const Key& key) const
+{
+  Node* result = nullptr;
+  Node* actual = pRoot;
+  while (actual)
+  {
+    if (cmp(key, actual->data.first))
+    {
+      result = actual;
+      actual = actual->left;
+    }
+    else
+    {
+      actual = actual->right;
+    }
+  }
+  return result;
+}
+
 template< typename Key, typename Value, typename Compare >
 template< typename F >
 F nikiforov::AvlTree< Key, Value, Compare >::traverse_lnr(F f) const
@@ -907,6 +1043,8 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree< Ke
   tmp->right = pNode;
   tmp->right->parent = tmp;
   tmp->parent = parent;
+  updateSize(pNode);
+  updateSize(tmp);
   return tmp;
 }
 
@@ -923,6 +1061,8 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree< Ke
   tmp->left = pNode;
   tmp->left->parent = tmp;
   tmp->parent = parent;
+  updateSize(pNode);
+  updateSize(tmp);
   return tmp;
 }
 
@@ -960,6 +1100,7 @@ nikiforov::AvlTree<Key, Value, Compare>::insertData(Node* pNode, const Key& key,
       pNode->left = insertData(pNode->left, key, value);
       pNode->left->parent = pNode;
     }
+    updateSize(pNode);
   }
   return balance(pNode);
 }
@@ -967,11 +1108,13 @@ nikiforov::AvlTree<Key, Value, Compare>::insertData(Node* pNode, const Key& key,
 template< typename Key, typename Value, typename Compare >
 size_t nikiforov::AvlTree<Key, Value, Compare>::countSize(Node* pNode) const
 {
-  if (pNode == nullptr)
-  {
-    return 0;
-  }
-  return (countSize(pNode->left) + countSize(pNode->right) + 1);
+  return pNode != nullptr ? pNode->count : 0;
+}
+
+template< typename Key, typename Value, typename Compare >
+void nikiforov::AvlTree<Key, Value, Compare>::updateSize(Node* pNode)
+{
+  pNode->count = countSize(pNode->left) + countSize(pNode->right) + 1;
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -1057,7 +1200,17 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree<Key
       }
       else
       {
+        Node* parent = pNode->parent;
         *pNode = *actual;
+        pNode->parent = parent;
+        if (pNode->left != nullptr)
+        {
+          pNode->left->parent = pNode;
+        }
+        if (pNode->right != nullptr)
+        {
+          pNode->right->parent = pNode;
+        }
       }
       delete actual;
     }
@@ -1077,7 +1230,12 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree<Key
     pNode->left = remove(pNode->left, key);
   }
 
-  return pNode == nullptr ? pNode : balance(pNode);
+  if (pNode == nullptr)
+  {
+    return pNode;
+  }
+  updateSize(pNode);
+  return balance(pNode);
 }
 
 template< typename Key, typename Value, typename Compare >
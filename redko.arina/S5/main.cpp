@@ -1,6 +1,9 @@
 #include <iostream>
 #include <fstream>
 #include <functional>
+#ifdef REDKO_PARALLEL_EVALUATION
+#include <thread>
+#endif
 #include <inputFunctions.hpp>
 #include <dataFunctions.hpp>
 #include "binarySearchTree.hpp"
@@ -22,9 +25,9 @@ int main(int argc, char ** argv)
   }
 
   redko::BSTree< std::string, std::function< redko::SumAndOrder(redko::BSTree< int, std::string > *, redko::SumAndOrder) > > functions{};
-  functions.insert({ "ascending", &redko::BSTree< int, std::string >::traverseLR< redko::SumAndOrder > });
-  functions.insert({ "descending", &redko::BSTree< int, std::string >::traverseRL< redko::SumAndOrder > });
-  functions.insert({ "breadth", &redko::BSTree< int, std::string >::traverseBreadth< redko::SumAndOrder > });
+  functions.insert({ "ascending", &redko::BSTree< int, std::string >::traverseLRByParent< redko::SumAndOrder > });
+  functions.insert({ "descending", &redko::BSTree< int, std::string >::traverseRLByParent< redko::SumAndOrder > });
+  functions.insert({ "breadth", &redko::BSTree< int, std::string >::traverseBreadthBuffered< redko::SumAndOrder > });
 
   redko::BSTree< int, std::string > data{};
   std::string description = "";
@@ -49,23 +52,36 @@ int main(int argc, char ** argv)
   {
     if (functions.find(argv[1]) != functions.end())
     {
-      redko::SumAndOrder result{};
+      int sum = 0;
+      redko::SumAndOrder init{};
+#ifdef REDKO_PARALLEL_EVALUATION
+      size_t workers = std::thread::hardware_concurrency();
+      redko::KeyTotals keys = data.parallelReduce(redko::KeyTotals(), std::plus< redko::KeyTotals >(), (workers == 0) ? 1 : workers);
+      if (keys.fitsInt())
+      {
+        init.sum = keys.sum;
+        init.isSumKnown = true;
+      }
+#endif
       try
       {
-        result = functions[argv[1]](&data, redko::SumAndOrder());
+        if (!init.isSumKnown)
+        {
+          init = functions[argv[1]](&data, init);
+        }
+        sum = init.getSum();
       }
       catch (const std::out_of_range & e)
       {
         std::cerr << e.what() << '\n';
         return 1;
       }
-      std::cout << result.sum;
-      while (!result.valueOrder.empty())
-      {
-        std::cout << ' ' << result.valueOrder.front();
-        result.valueOrder.pop();
-      }
-      std::cout << '\n';
+      redko::OutputBuffer buffer(std::cout);
+      buffer << sum;
+      redko::SumAndOrder order{};
+      order.out = &buffer;
+      functions[argv[1]](&data, order);
+      buffer << '\n';
     }
     else
     {
@@ -3,7 +3,8 @@
 #include <utility>
 #include <string>
 #include <limits>
-#include "queue.hpp"
+#include <stdexcept>
+#include "outputBuffer.hpp"
 
 namespace redko
 {
@@ -11,20 +12,61 @@ namespace redko
   {
     void operator()(const std::pair< int, std::string > & value)
     {
-      if (value.first > 0 && sum > std::numeric_limits< int >::max() - value.first)
+      if (out != nullptr)
+      {
+        *out << ' ' << value.second;
+      }
+      else
+      {
+        sum += value.first;
+        if (!isOverflowed && !isUnderflowed)
+        {
+          isOverflowed = sum > std::numeric_limits< int >::max();
+          isUnderflowed = sum < std::numeric_limits< int >::min();
+        }
+      }
+    }
+    int getSum() const
+    {
+      if (isOverflowed)
       {
         throw std::out_of_range("Error: unable to calculate the sum due to overflow");
       }
-      else if (value.first < 0 && sum < std::numeric_limits< int >::min() - value.first)
+      else if (isUnderflowed)
       {
         throw std::out_of_range("Error: unable to calculate the sum due to underflow");
       }
+      return static_cast< int >(sum);
+    }
+    long long sum = 0;
+    bool isOverflowed = false;
+    bool isUnderflowed = false;
+    bool isSumKnown = false;
+    OutputBuffer * out = nullptr;
+  };
+
+  struct KeyTotals
+  {
+    void operator()(const std::pair< int, std::string > & value)
+    {
       sum += value.first;
-      valueOrder.push(value.second);
+      magnitude += (value.first < 0) ? -static_cast< long long >(value.first) : value.first;
     }
-    int sum = 0;
-    Queue< std::string > valueOrder;
+    bool fitsInt() const
+    {
+      return magnitude <= std::numeric_limits< int >::max();
+    }
+    long long sum = 0;
+    long long magnitude = 0;
   };
+
+  inline KeyTotals operator+(const KeyTotals & lhs, const KeyTotals & rhs)
+  {
+    KeyTotals result{};
+    result.sum = lhs.sum + rhs.sum;
+    result.magnitude = lhs.magnitude + rhs.magnitude;
+    return result;
+  }
 }
 
 #endif
@@ -2,8 +2,16 @@
 #define BINARYSEARCHTREE_HPP
 #include <utility>
 #include <stdexcept>
+#include <algorithm>
+#ifdef REDKO_PARALLEL_EVALUATION
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+#endif
 #include "stack.hpp"
 #include "queue.hpp"
+#include "ringBuffer.hpp"
 
 namespace redko
 {
@@ -77,9 +85,25 @@ namespace redko
     template< typename F >
     F traverseRL(F func);
     template< typename F >
+    F ctraverseLRByParent(F func) const;
+    template< typename F >
+    F traverseLRByParent(F func);
+    template< typename F >
+    F ctraverseRLByParent(F func) const;
+    template< typename F >
+    F traverseRLByParent(F func);
+    template< typename F >
     F ctraverseBreadth(F func) const;
     template< typename F >
     F traverseBreadth(F func);
+    template< typename F >
+    F ctraverseBreadthBuffered(F func) const;
+    template< typename F >
+    F traverseBreadthBuffered(F func);
+#ifdef REDKO_PARALLEL_EVALUATION
+    template< typename F, typename Combine >
+    F parallelReduce(F func, Combine combine, size_t workers) const;
+#endif
 
   private:
     struct Node
@@ -99,8 +123,19 @@ namespace redko
 
     Node * root_;
     Compare cmp_;
+    RingBuffer< Node * > frontier_;
 
     void deleteSubtree(Node * root);
+    template< typename F >
+    static F walkByParent(Node * root, F func, Node * Node::* lead, Node * Node::* follow);
+    template< typename F >
+    static F walkBreadth(Node * root, F func, RingBuffer< Node * > & frontier);
+#ifdef REDKO_PARALLEL_EVALUATION
+    template< typename F >
+    static F foldSubtree(Node * top, F func);
+    template< typename F >
+    static void foldStripe(const std::vector< Node * > & tops, std::vector< F > & parts, size_t first, size_t step, std::exception_ptr & error);
+#endif
 
     size_t getCountNode(Node * root) const;
     size_t getHeight(Node * node);
@@ -1196,6 +1231,66 @@ F redko::BSTree< Key, Value, Compare >::traverseRL(F func)
   return func;
 }
 
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::walkByParent(Node * root, F func, Node * Node::* lead, Node * Node::* follow)
+{
+  Node * curr = root;
+  while (curr != nullptr && curr->*lead != nullptr)
+  {
+    curr = curr->*lead;
+  }
+  while (curr != nullptr)
+  {
+    func(curr->elem);
+    if (curr->*follow != nullptr)
+    {
+      curr = curr->*follow;
+      while (curr->*lead != nullptr)
+      {
+        curr = curr->*lead;
+      }
+    }
+    else
+    {
+      while (curr->parent != nullptr && curr == curr->parent->*follow)
+      {
+        curr = curr->parent;
+      }
+      curr = curr->parent;
+    }
+  }
+  return func;
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::ctraverseLRByParent(F func) const
+{
+  return walkByParent(root_, func, &Node::left, &Node::right);
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::traverseLRByParent(F func)
+{
+  return walkByParent(root_, func, &Node::left, &Node::right);
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::ctraverseRLByParent(F func) const
+{
+  return walkByParent(root_, func, &Node::right, &Node::left);
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::traverseRLByParent(F func)
+{
+  return walkByParent(root_, func, &Node::right, &Node::left);
+}
+
 template < typename Key, typename Value, typename Compare >
 template< typename F >
 F redko::BSTree< Key, Value, Compare >::ctraverseBreadth(F func) const
@@ -1252,6 +1347,118 @@ F redko::BSTree< Key, Value, Compare >::traverseBreadth(F func)
   return func;
 }
 
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::walkBreadth(Node * root, F func, RingBuffer< Node * > & frontier)
+{
+  frontier.clear();
+  if (root != nullptr)
+  {
+    frontier.push(root);
+  }
+  while (!frontier.empty())
+  {
+    Node * node = frontier.front();
+    func(node->elem);
+    frontier.pop();
+    if (node->left != nullptr)
+    {
+      frontier.push(node->left);
+    }
+    if (node->right != nullptr)
+    {
+      frontier.push(node->right);
+    }
+  }
+  return func;
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::ctraverseBreadthBuffered(F func) const
+{
+  RingBuffer< Node * > frontier;
+  return walkBreadth(root_, func, frontier);
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::traverseBreadthBuffered(F func)
+{
+  return walkBreadth(root_, func, frontier_);
+}
+
+#ifdef REDKO_PARALLEL_EVALUATION
+template < typename Key, typename Value, typename Compare >
+template< typename F, typename Combine >
+F redko::BSTree< Key, Value, Compare >::parallelReduce(F func, Combine combine, size_t workers) const
+{
+  if (empty() || workers <= 1)
+  {
+    return ctraverseLRByParent(func);
+  }
+  std::vector< Node * > tops;
+  tops.push_back(root_);
+  size_t taken = 0;
+  while (taken < tops.size() && tops.size() - taken < workers * 4)
+  {
+    Node * node = tops[taken++];
+    func(node->elem);
+    if (node->left != nullptr)
+    {
+      tops.push_back(node->left);
+    }
+    if (node->right != nullptr)
+    {
+      tops.push_back(node->right);
+    }
+  }
+  tops.erase(tops.begin(), tops.begin() + taken);
+  if (tops.empty())
+  {
+    return func;
+  }
+  size_t stripes = (tops.size() < workers) ? tops.size() : workers;
+  std::vector< F > parts(tops.size());
+  std::vector< std::exception_ptr > errors(stripes);
+  std::vector< std::thread > threads;
+  size_t started = 1;
+  try
+  {
+    for (; started < stripes; ++started)
+    {
+      threads.emplace_back([&, started]()
+      {
+        foldStripe(tops, parts, started, stripes, errors[started]);
+      });
+    }
+  }
+  catch (const std::system_error &)
+  {}
+  foldStripe(tops, parts, 0, stripes, errors[0]);
+  for (size_t i = started; i < stripes; ++i)
+  {
+    foldStripe(tops, parts, i, stripes, errors[i]);
+  }
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+  for (size_t i = 0; i < stripes; ++i)
+  {
+    if (errors[i])
+    {
+      std::rethrow_exception(errors[i]);
+    }
+  }
+  for (size_t i = 0; i < parts.size(); ++i)
+  {
+    func = combine(func, parts[i]);
+  }
+  return func;
+}
+#endif
+
 template < typename Key, typename Value, typename Compare >
 void redko::BSTree< Key, Value, Compare >::deleteSubtree(Node * root)
 {
@@ -1513,4 +1720,56 @@ typename redko::BSTree< Key, Value, Compare >::Node * redko::BSTree< Key, Value,
   return node;
 }
 
+#ifdef REDKO_PARALLEL_EVALUATION
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+F redko::BSTree< Key, Value, Compare >::foldSubtree(Node * top, F func)
+{
+  Node * stop = top->parent;
+  Node * curr = top;
+  while (curr->left != nullptr)
+  {
+    curr = curr->left;
+  }
+  while (curr != stop)
+  {
+    func(curr->elem);
+    if (curr->right != nullptr)
+    {
+      curr = curr->right;
+      while (curr->left != nullptr)
+      {
+        curr = curr->left;
+      }
+    }
+    else
+    {
+      while (curr->parent != stop && curr == curr->parent->right)
+      {
+        curr = curr->parent;
+      }
+      curr = curr->parent;
+    }
+  }
+  return func;
+}
+
+template < typename Key, typename Value, typename Compare >
+template< typename F >
+void redko::BSTree< Key, Value, Compare >::foldStripe(const std::vector< Node * > & tops, std::vector< F > & parts, size_t first, size_t step, std::exception_ptr & error)
+{
+  try
+  {
+    for (size_t i = first; i < tops.size(); i += step)
+    {
+      parts[i] = foldSubtree(tops[i], F());
+    }
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+}
+#endif
+
 #endif
@@ -0,0 +1,106 @@
+#ifndef OUTPUTBUFFER_HPP
+#define OUTPUTBUFFER_HPP
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace redko
+{
+  class OutputBuffer {
+  public:
+    explicit OutputBuffer(std::ostream & out, size_t capacity = 65536);
+    OutputBuffer(const OutputBuffer &) = delete;
+    ~OutputBuffer();
+
+    OutputBuffer & operator=(const OutputBuffer &) = delete;
+
+    OutputBuffer & operator<<(char symbol);
+    OutputBuffer & operator<<(const std::string & str);
+    OutputBuffer & operator<<(int value);
+
+    void write(const char * data, size_t length);
+    void flush();
+
+  private:
+    std::ostream & out_;
+    std::string buffer_;
+    size_t capacity_;
+  };
+}
+
+inline redko::OutputBuffer::OutputBuffer(std::ostream & out, size_t capacity):
+  out_(out),
+  buffer_(),
+  capacity_(capacity)
+{}
+
+inline redko::OutputBuffer::~OutputBuffer()
+{
+  try
+  {
+    flush();
+  }
+  catch (...)
+  {}
+}
+
+inline redko::OutputBuffer & redko::OutputBuffer::operator<<(char symbol)
+{
+  buffer_.push_back(symbol);
+  if (buffer_.size() >= capacity_)
+  {
+    flush();
+  }
+  return *this;
+}
+
+inline redko::OutputBuffer & redko::OutputBuffer::operator<<(const std::string & str)
+{
+  write(str.data(), str.length());
+  return *this;
+}
+
+inline redko::OutputBuffer & redko::OutputBuffer::operator<<(int value)
+{
+  unsigned long long magnitude = static_cast< unsigned long long >(value);
+  if (value < 0)
+  {
+    magnitude = 0 - magnitude;
+  }
+  char digits[16];
+  char * begin = digits + sizeof(digits);
+  do
+  {
+    *--begin = static_cast< char >('0' + magnitude % 10);
+    magnitude /= 10;
+  }
+  while (magnitude != 0);
+  if (value < 0)
+  {
+    *--begin = '-';
+  }
+  write(begin, digits + sizeof(digits) - begin);
+  return *this;
+}
+
+inline void redko::OutputBuffer::write(const char * data, size_t length)
+{
+  if (buffer_.size() + length > capacity_)
+  {
+    flush();
+    if (length >= capacity_)
+    {
+      out_.write(data, length);
+      return;
+    }
+  }
+  buffer_.append(data, length);
+}
+
+inline void redko::OutputBuffer::flush()
+{
+  out_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+#endif
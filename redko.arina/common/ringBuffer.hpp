@@ -0,0 +1,122 @@
+#ifndef RINGBUFFER_HPP
+#define RINGBUFFER_HPP
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace redko
+{
+  template < typename T >
+  class RingBuffer {
+  public:
+    RingBuffer(): data_(), head_(0), size_(0) {}
+
+    T & front();
+    const T & front() const;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+
+    void reserve(size_t capacity);
+    void push(const T & value);
+    void pop();
+    void clear() noexcept;
+
+  private:
+    std::vector< T > data_;
+    size_t head_;
+    size_t size_;
+  };
+}
+
+template < typename T >
+T & redko::RingBuffer< T >::front()
+{
+  if (empty())
+  {
+    throw std::logic_error("Error: empty container");
+  }
+  return data_[head_];
+}
+
+template < typename T >
+const T & redko::RingBuffer< T >::front() const
+{
+  if (empty())
+  {
+    throw std::logic_error("Error: empty container");
+  }
+  return data_[head_];
+}
+
+template < typename T >
+bool redko::RingBuffer< T >::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+template < typename T >
+size_t redko::RingBuffer< T >::size() const noexcept
+{
+  return size_;
+}
+
+template < typename T >
+size_t redko::RingBuffer< T >::capacity() const noexcept
+{
+  return data_.size();
+}
+
+template < typename T >
+void redko::RingBuffer< T >::reserve(size_t capacity)
+{
+  if (capacity <= data_.size())
+  {
+    return;
+  }
+  size_t newCapacity = 1;
+  while (newCapacity < capacity)
+  {
+    newCapacity *= 2;
+  }
+  std::vector< T > newData(newCapacity);
+  for (size_t i = 0; i < size_; ++i)
+  {
+    newData[i] = std::move(data_[(head_ + i) & (data_.size() - 1)]);
+  }
+  data_.swap(newData);
+  head_ = 0;
+}
+
+template < typename T >
+void redko::RingBuffer< T >::push(const T & value)
+{
+  if (size_ == data_.size())
+  {
+    reserve(size_ + 1);
+  }
+  data_[(head_ + size_) & (data_.size() - 1)] = value;
+  ++size_;
+}
+
+template < typename T >
+void redko::RingBuffer< T >::pop()
+{
+  if (empty())
+  {
+    throw std::logic_error("Error: empty container");
+  }
+  head_ = (head_ + 1) & (data_.size() - 1);
+  --size_;
+}
+
+template < typename T >
+void redko::RingBuffer< T >::clear() noexcept
+{
+  head_ = 0;
+  size_ = 0;
+}
+
+#endif
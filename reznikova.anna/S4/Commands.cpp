@@ -1,4 +1,9 @@
 #include "Commands.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
 void reznikova::outputInvalidCommand(std::ostream & out)
 {
@@ -10,53 +15,126 @@ void reznikova::outputEmptyError(std::ostream & out)
   out << "<EMPTY>\n";
 }
 
-std::string reznikova::getValue(std::string & input, size_t & i)
+namespace
 {
-  std::string result = "";
-  while (i < input.length() and input[i] != ' ')
+  const size_t blockSize = 1 << 20;
+
+  const char * findValueEnd(const char * pos, const char * end)
+  {
+    const char * space = static_cast< const char * >(std::memchr(pos, ' ', end - pos));
+    return space ? space : end;
+  }
+
+  size_t parseKey(const char *& pos, const char * end)
+  {
+    const size_t maxKey = std::numeric_limits< size_t >::max();
+    const char * start = pos;
+    size_t result = 0;
+    while (pos != end and *pos >= '0' and *pos <= '9')
+    {
+      size_t digit = *pos - '0';
+      if (result > (maxKey - digit) / 10)
+      {
+        throw std::out_of_range("Key is too large");
+      }
+      result = result * 10 + digit;
+      ++pos;
+    }
+    if (pos == start)
+    {
+      throw std::invalid_argument("Key expected");
+    }
+    return result;
+  }
+
+  using pair_type = std::pair< size_t, reznikova::StringArena::handle_type >;
+
+  void parseLine(const char * pos, const char * end, reznikova::DictionaryStorage & storage,
+    std::vector< pair_type > & pairs)
   {
-    result += input[i];
-    i++;
+    const char * nameEnd = findValueEnd(pos, end);
+    std::string name(pos, nameEnd);
+    pos = (nameEnd == end) ? end : nameEnd + 1;
+    pairs.clear();
+    while (pos != end)
+    {
+      size_t key = parseKey(pos, end);
+      pos = (pos == end) ? end : pos + 1;
+      const char * valueEnd = findValueEnd(pos, end);
+      pairs.push_back(std::make_pair(key, storage.values.intern(pos, valueEnd - pos)));
+      pos = (valueEnd == end) ? end : valueEnd + 1;
+    }
+    auto keyLess = [](const pair_type & lhs, const pair_type & rhs)
+    {
+      return lhs.first < rhs.first;
+    };
+    auto keyEqual = [](const pair_type & lhs, const pair_type & rhs)
+    {
+      return lhs.first == rhs.first;
+    };
+    if (not std::is_sorted(pairs.begin(), pairs.end(), keyLess))
+    {
+      std::stable_sort(pairs.begin(), pairs.end(), keyLess);
+    }
+    pairs.erase(std::unique(pairs.begin(), pairs.end(), keyEqual), pairs.end());
+    storage.dictionaries.insert(name, reznikova::dictionary_type::buildFromSorted(pairs.cbegin(), pairs.cend()));
   }
-  i++;
+}
+
+std::string reznikova::getValue(std::string & input, size_t & i)
+{
+  size_t end = std::min(input.find(' ', i), input.length());
+  std::string result = input.substr(i, end - i);
+  i = end + 1;
   return result;
 }
 
 size_t reznikova::getKey(std::string & input, size_t & i)
 {
-  std::string result = "";
-  while (i < input.length() and input[i] != ' ' and isdigit(input[i]))
-  {
-    result += input[i];
-    i++;
-  }
-  i++;
-  return std::stoul(result);
+  const char * pos = input.data() + i;
+  size_t result = parseKey(pos, input.data() + input.length());
+  i = pos - input.data() + 1;
+  return result;
 }
 
-void reznikova::readFromFile(std::ifstream & is, Tree< std::string, Tree< size_t, std::string > > & treeMap)
+void reznikova::readFromFile(std::ifstream & is, DictionaryStorage & storage)
 {
-  std::string input;
-  while (getline(is, input))
+  std::vector< char > block(blockSize);
+  std::string tail;
+  std::vector< pair_type > pairs;
+  while (is.read(block.data(), block.size()) or is.gcount() > 0)
   {
-    size_t i = 0;
-    std::string name = getValue(input, i);
-    Tree< size_t, std::string > tree;
-    while (i < input.length())
+    const char * pos = block.data();
+    const char * end = pos + is.gcount();
+    const char * newline = nullptr;
+    while ((newline = static_cast< const char * >(std::memchr(pos, '\n', end - pos))) != nullptr)
     {
-      size_t key = getKey(input, i);
-      std::string value = getValue(input, i);
-      tree.insert(key, value);
+      if (tail.empty())
+      {
+        parseLine(pos, newline, storage, pairs);
+      }
+      else
+      {
+        tail.append(pos, newline);
+        parseLine(tail.data(), tail.data() + tail.length(), storage, pairs);
+        tail.clear();
+      }
+      pos = newline + 1;
     }
-    treeMap.insert(name, tree);
+    tail.append(pos, end);
+  }
+  if (not tail.empty())
+  {
+    parseLine(tail.data(), tail.data() + tail.length(), storage, pairs);
   }
 }
 
-void reznikova::printCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap)
+void reznikova::printCommand(DictionaryStorage & storage)
 {
+  storage_type & treeMap = storage.dictionaries;
   std::string name;
   std::cin >> name;
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator it = treeMap.find(name);
+  storage_type::ConstIterator it = treeMap.find(name);
   if (it == treeMap.cend())
   {
     outputInvalidCommand(std::cout);
@@ -68,30 +146,32 @@ void reznikova::printCommand(Tree< std::string, Tree< size_t, std::string > > &
     return;
   }
   std::cout << name;
-  Tree< size_t, std::string >::ConstIterator dictIt = it->second.cbegin();
+  dictionary_type::ConstIterator dictIt = it->second.cbegin();
   while (dictIt != it->second.cend())
   {
-    std::cout <<  " " << dictIt->first << " " << dictIt->second;
+    std::cout <<  " " << dictIt->first << " ";
+    storage.values.write(std::cout, dictIt->second);
     ++dictIt;
   }
   std::cout << "\n";
 }
 
-void reznikova::complementCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap)
+void reznikova::complementCommand(DictionaryStorage & storage)
 {
+  storage_type & treeMap = storage.dictionaries;
   std::string newDict;
   std::string firstDict;
   std::string secondDict;
   std::cin >> newDict >> firstDict >> secondDict;
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator firstIt = treeMap.find(firstDict);
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator secondIt = treeMap.find(secondDict);
+  storage_type::ConstIterator firstIt = treeMap.find(firstDict);
+  storage_type::ConstIterator secondIt = treeMap.find(secondDict);
   if (firstIt == treeMap.cend() or secondIt == treeMap.cend())
   {
     outputInvalidCommand(std::cout);
     return;
   }
-  Tree< size_t, std::string > dictionary;
-  Tree< size_t, std::string >::ConstIterator firstSubIter = firstIt->second.cbegin();
+  dictionary_type dictionary;
+  dictionary_type::ConstIterator firstSubIter = firstIt->second.cbegin();
   while (firstSubIter != firstIt->second.cend())
   {
     if (secondIt->second.find(firstSubIter->first) == secondIt->second.cend())
@@ -100,7 +180,7 @@ void reznikova::complementCommand(Tree< std::string, Tree< size_t, std::string >
     }
     firstSubIter++;
   }
-  Tree< size_t, std::string >::ConstIterator secondSubIter = secondIt->second.cbegin();
+  dictionary_type::ConstIterator secondSubIter = secondIt->second.cbegin();
   while (secondSubIter != secondIt->second.cend())
   {
     if (firstIt->second.find(secondSubIter->first) == firstIt->second.cend())
@@ -109,7 +189,7 @@ void reznikova::complementCommand(Tree< std::string, Tree< size_t, std::string >
     }
     secondSubIter++;
   }
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator it = treeMap.find(newDict);
+  storage_type::ConstIterator it = treeMap.find(newDict);
   if (it != treeMap.cend())
   {
     treeMap.erase(it->first);
@@ -117,21 +197,22 @@ void reznikova::complementCommand(Tree< std::string, Tree< size_t, std::string >
   treeMap.insert(newDict, dictionary);
 }
 
-void reznikova::intersectCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap)
+void reznikova::intersectCommand(DictionaryStorage & storage)
 {
+  storage_type & treeMap = storage.dictionaries;
   std::string newDict;
   std::string firstDict;
   std::string secondDict;
   std::cin >> newDict >> firstDict >> secondDict;
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator firstIt = treeMap.find(firstDict);
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator secondIt = treeMap.find(secondDict);
+  storage_type::ConstIterator firstIt = treeMap.find(firstDict);
+  storage_type::ConstIterator secondIt = treeMap.find(secondDict);
   if (firstIt == treeMap.cend() or secondIt == treeMap.cend())
   {
     outputInvalidCommand(std::cout);
     return;
   }
-  Tree< size_t, std::string > dictionary;
-  Tree< size_t, std::string >::ConstIterator firstSubIter = firstIt->second.cbegin();
+  dictionary_type dictionary;
+  dictionary_type::ConstIterator firstSubIter = firstIt->second.cbegin();
   while (firstSubIter != firstIt->second.cend())
   {
     if (secondIt->second.find(firstSubIter->first) != secondIt->second.cend())
@@ -140,7 +221,7 @@ void reznikova::intersectCommand(Tree< std::string, Tree< size_t, std::string >
     }
     firstSubIter++;
   }
-  Tree< size_t, std::string >::ConstIterator secondSubIter = secondIt->second.cbegin();
+  dictionary_type::ConstIterator secondSubIter = secondIt->second.cbegin();
   while (secondSubIter != secondIt->second.cend())
   {
     if (firstIt->second.find(secondSubIter->first) != firstIt->second.cend())
@@ -149,7 +230,7 @@ void reznikova::intersectCommand(Tree< std::string, Tree< size_t, std::string >
     }
     secondSubIter++;
   }
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator it = treeMap.find(newDict);
+  storage_type::ConstIterator it = treeMap.find(newDict);
   if (it != treeMap.cend())
   {
     treeMap.erase(it->first);
@@ -157,33 +238,34 @@ void reznikova::intersectCommand(Tree< std::string, Tree< size_t, std::string >
   treeMap.insert(newDict, dictionary);
 }
 
-void reznikova::unionCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap)
+void reznikova::unionCommand(DictionaryStorage & storage)
 {
+  storage_type & treeMap = storage.dictionaries;
   std::string newDict;
   std::string firstDict;
   std::string secondDict;
   std::cin >> newDict >> firstDict >> secondDict;
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator firstIt = treeMap.find(firstDict);
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator secondIt = treeMap.find(secondDict);
+  storage_type::ConstIterator firstIt = treeMap.find(firstDict);
+  storage_type::ConstIterator secondIt = treeMap.find(secondDict);
   if (firstIt == treeMap.cend() or secondIt == treeMap.cend())
   {
     outputInvalidCommand(std::cout);
     return;
   }
-  Tree< size_t, std::string > dictionary;
-  Tree< size_t, std::string >::ConstIterator firstSubIter = firstIt->second.cbegin();
+  dictionary_type dictionary;
+  dictionary_type::ConstIterator firstSubIter = firstIt->second.cbegin();
   while (firstSubIter != firstIt->second.cend())
   {
     dictionary.insert(firstSubIter->first, firstSubIter->second);
     firstSubIter++;
   }
-  Tree< size_t, std::string >::ConstIterator secondSubIter = secondIt->second.cbegin();
+  dictionary_type::ConstIterator secondSubIter = secondIt->second.cbegin();
   while (secondSubIter != secondIt->second.cend())
   {
     dictionary.insert(secondSubIter->first, secondSubIter->second);
     secondSubIter++;
   }
-  Tree< std::string, Tree< size_t, std::string > >::ConstIterator it = treeMap.find(newDict);
+  storage_type::ConstIterator it = treeMap.find(newDict);
   if (it != treeMap.cend())
   {
     treeMap.erase(it->first);
@@ -1,18 +1,30 @@
 #ifndef COMMANDS_HPP
 #define COMMANDS_HPP
 #include <fstream>
+#include <memory>
+#include "StringArena.hpp"
 #include "Tree.hpp"
 
 namespace reznikova
 {
+  using dictionary_type = Tree< size_t, StringArena::handle_type >;
+  using storage_type = Tree< std::string, dictionary_type >;
+
+  struct DictionaryStorage
+  {
+    std::shared_ptr< const char > snapshot;
+    StringArena values;
+    storage_type dictionaries;
+  };
+
   void outputInvalidCommand(std::ostream & out);
   void outputEmptyError(std::ostream & out);
   std::string getValue(std::string & input, size_t & i);
   size_t getKey(std::string & input, size_t & i);
-  void readFromFile(std::ifstream & is, Tree< std::string, Tree< size_t, std::string > > & treeMap);
-  void printCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap);
-  void complementCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap);
-  void intersectCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap);
-  void unionCommand(Tree< std::string, Tree< size_t, std::string > > & treeMap);
+  void readFromFile(std::ifstream & is, DictionaryStorage & storage);
+  void printCommand(DictionaryStorage & storage);
+  void complementCommand(DictionaryStorage & storage);
+  void intersectCommand(DictionaryStorage & storage);
+  void unionCommand(DictionaryStorage & storage);
 }
 #endif
@@ -0,0 +1,157 @@
+#include "Snapshot.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+  const char snapshotMagic[8] = {'R', 'Z', 'S', 'N', 'A', 'P', '0', '1'};
+
+  std::shared_ptr< const char > mapFile(const char * fileName, size_t & size)
+  {
+#ifdef _WIN32
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in)
+    {
+      throw std::runtime_error("Can't open snapshot");
+    }
+    std::vector< char > content((std::istreambuf_iterator< char >(in)), std::istreambuf_iterator< char >());
+    size = content.size();
+    std::shared_ptr< char > data(new char[size + 1], std::default_delete< char[] >());
+    std::copy(content.begin(), content.end(), data.get());
+    return data;
+#else
+    int fd = open(fileName, O_RDONLY);
+    if (fd == -1)
+    {
+      throw std::runtime_error("Can't open snapshot");
+    }
+    struct stat info;
+    if (fstat(fd, &info) == -1 or static_cast< size_t >(info.st_size) < sizeof(reznikova::SnapshotHeader))
+    {
+      close(fd);
+      throw std::runtime_error("Snapshot is too short");
+    }
+    size = info.st_size;
+    void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == reinterpret_cast< void * >(-1))
+    {
+      throw std::runtime_error("Can't map snapshot");
+    }
+    size_t length = size;
+    return std::shared_ptr< const char >(static_cast< const char * >(data), [length](const char * ptr)
+    {
+      munmap(const_cast< char * >(ptr), length);
+    });
+#endif
+  }
+
+  void writeBlock(std::ostream & out, const void * data, size_t size)
+  {
+    if (not out.write(static_cast< const char * >(data), size))
+    {
+      throw std::runtime_error("Can't write snapshot");
+    }
+  }
+}
+
+bool reznikova::isSnapshot(const char * fileName)
+{
+  std::ifstream in(fileName, std::ios::binary);
+  char magic[sizeof(snapshotMagic)] = {};
+  in.read(magic, sizeof(magic));
+  return in and std::equal(magic, magic + sizeof(magic), snapshotMagic);
+}
+
+void reznikova::writeSnapshot(std::ostream & out, DictionaryStorage & storage)
+{
+  std::vector< SnapshotDictionary > dictionaries;
+  std::vector< SnapshotPair > pairs;
+  for (storage_type::ConstIterator it = storage.dictionaries.cbegin(); it != storage.dictionaries.cend(); ++it)
+  {
+    SnapshotDictionary dictionary = {pairs.size(), 0, storage.values.intern(it->first), 0};
+    for (dictionary_type::ConstIterator dictIt = it->second.cbegin(); dictIt != it->second.cend(); ++dictIt)
+    {
+      pairs.push_back(SnapshotPair{dictIt->first, dictIt->second, 0});
+    }
+    dictionary.pairCount = pairs.size() - dictionary.firstPair;
+    dictionaries.push_back(dictionary);
+  }
+  const StringArena & values = storage.values;
+  SnapshotHeader header = {{}, dictionaries.size(), pairs.size(), values.getCount(), values.getBufferSize()};
+  std::copy(snapshotMagic, snapshotMagic + sizeof(snapshotMagic), header.magic);
+  writeBlock(out, std::addressof(header), sizeof(header));
+  writeBlock(out, dictionaries.data(), dictionaries.size() * sizeof(SnapshotDictionary));
+  writeBlock(out, pairs.data(), pairs.size() * sizeof(SnapshotPair));
+  writeBlock(out, values.getOffsets(), (values.getCount() + 1) * sizeof(uint32_t));
+  writeBlock(out, values.getBuffer(), values.getBufferSize());
+}
+
+void reznikova::readSnapshot(const char * fileName, DictionaryStorage & storage)
+{
+  size_t size = 0;
+  std::shared_ptr< const char > data = mapFile(fileName, size);
+  SnapshotHeader header;
+  std::memcpy(std::addressof(header), data.get(), sizeof(header));
+  if (not std::equal(snapshotMagic, snapshotMagic + sizeof(snapshotMagic), header.magic))
+  {
+    throw std::runtime_error("Not a snapshot");
+  }
+  if (header.dictionaryCount > size or header.pairCount > size or header.stringCount > size or header.bufferSize > size)
+  {
+    throw std::runtime_error("Snapshot is damaged");
+  }
+  size_t expected = sizeof(header) + header.dictionaryCount * sizeof(SnapshotDictionary);
+  expected += header.pairCount * sizeof(SnapshotPair) + (header.stringCount + 1) * sizeof(uint32_t) + header.bufferSize;
+  if (expected != size)
+  {
+    throw std::runtime_error("Snapshot is damaged");
+  }
+  const char * pos = data.get() + sizeof(header);
+  const SnapshotDictionary * dictionaries = reinterpret_cast< const SnapshotDictionary * >(pos);
+  pos += header.dictionaryCount * sizeof(SnapshotDictionary);
+  const SnapshotPair * pairs = reinterpret_cast< const SnapshotPair * >(pos);
+  pos += header.pairCount * sizeof(SnapshotPair);
+  const uint32_t * offsets = reinterpret_cast< const uint32_t * >(pos);
+  pos += (header.stringCount + 1) * sizeof(uint32_t);
+  if (offsets[0] != 0 or offsets[header.stringCount] != header.bufferSize
+    or not std::is_sorted(offsets, offsets + header.stringCount + 1))
+  {
+    throw std::runtime_error("Snapshot is damaged");
+  }
+  storage.values.attach(pos, offsets, header.stringCount);
+  storage.snapshot = data;
+  for (size_t i = 0; i < header.dictionaryCount; ++i)
+  {
+    const SnapshotDictionary & dictionary = dictionaries[i];
+    if (dictionary.name >= header.stringCount or dictionary.firstPair > header.pairCount
+      or dictionary.pairCount > header.pairCount - dictionary.firstPair)
+    {
+      throw std::runtime_error("Snapshot is damaged");
+    }
+    const SnapshotPair * first = pairs + dictionary.firstPair;
+    const SnapshotPair * last = first + dictionary.pairCount;
+    for (const SnapshotPair * pair = first; pair != last; ++pair)
+    {
+      if (pair->second >= header.stringCount or (pair != first and (pair - 1)->first >= pair->first))
+      {
+        throw std::runtime_error("Snapshot is damaged");
+      }
+    }
+    std::string name = storage.values.getString(dictionary.name);
+    dictionary_type tree = dictionary_type::buildFromSorted(first, last);
+    storage.dictionaries.insert(name, dictionary_type());
+    storage.dictionaries.at(name).swap(tree);
+  }
+}
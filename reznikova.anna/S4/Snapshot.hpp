@@ -0,0 +1,37 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+#include <cstdint>
+#include <ostream>
+#include "Commands.hpp"
+
+namespace reznikova
+{
+  struct SnapshotHeader
+  {
+    char magic[8];
+    uint64_t dictionaryCount;
+    uint64_t pairCount;
+    uint64_t stringCount;
+    uint64_t bufferSize;
+  };
+
+  struct SnapshotDictionary
+  {
+    uint64_t firstPair;
+    uint64_t pairCount;
+    uint32_t name;
+    uint32_t reserved;
+  };
+
+  struct SnapshotPair
+  {
+    uint64_t first;
+    uint32_t second;
+    uint32_t reserved;
+  };
+
+  bool isSnapshot(const char * fileName);
+  void writeSnapshot(std::ostream & out, DictionaryStorage & storage);
+  void readSnapshot(const char * fileName, DictionaryStorage & storage);
+}
+#endif
@@ -1,28 +1,67 @@
 #include <iostream>
 #include <fstream>
 #include <functional>
+#include <limits>
 #include <string>
 #include "Tree.hpp"
 #include "Commands.hpp"
+#include "Snapshot.hpp"
 
 int main(int argc, char ** argv)
 {
+  using namespace reznikova;
+  if (argc == 4 and std::string(argv[1]) == "--snapshot")
+  {
+    std::ifstream input(argv[2]);
+    std::ofstream output(argv[3], std::ios::binary);
+    if (!input or !output)
+    {
+      std::cerr << "Can't open files\n";
+      return 2;
+    }
+    DictionaryStorage storage;
+    try
+    {
+      readFromFile(input, storage);
+      writeSnapshot(output, storage);
+    }
+    catch (const std::exception & e)
+    {
+      std::cerr << e.what() << "\n";
+      return 2;
+    }
+    return 0;
+  }
   if (argc != 2)
   {
     std::cerr << "wrong number of args\n";
     return 1;
   }
-  using namespace reznikova;
-  std::ifstream input(argv[1]);
-  if (!input)
+  DictionaryStorage storage;
+  if (isSnapshot(argv[1]))
+  {
+    try
+    {
+      readSnapshot(argv[1], storage);
+    }
+    catch (const std::exception & e)
+    {
+      std::cerr << e.what() << "\n";
+      return 2;
+    }
+  }
+  else
   {
-    std::cerr << "Can't read from file\n";
-    return 2;
+    std::ifstream input(argv[1]);
+    if (!input)
+    {
+      std::cerr << "Can't read from file\n";
+      return 2;
+    }
+    readFromFile(input, storage);
   }
-  Tree< std::string, Tree< size_t, std::string > > treeMap;
-  readFromFile(input, treeMap);
 
-  Tree< std::string, std::function < void(Tree< std::string, Tree< size_t, std::string > >&) > > commands;
+  Tree< std::string, std::function < void(DictionaryStorage &) > > commands;
   commands.insert("print", printCommand);
   commands.insert("complement", complementCommand);
   commands.insert("intersect", intersectCommand);
@@ -32,7 +71,7 @@ int main(int argc, char ** argv)
   {
     try
     {
-      commands.at(command)(treeMap);
+      commands.at(command)(storage);
     }
     catch(const std::out_of_range& error)
     {
@@ -41,5 +80,10 @@ int main(int argc, char ** argv)
       std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     }
   }
+#ifdef REZNIKOVA_ARENA_STATS
+  ArenaStats stats = storage.values.getStats();
+  std::cerr << "arena: " << stats.strings << " strings, " << stats.lookups << " lookups, ";
+  std::cerr << stats.bufferBytes << " buffer bytes, " << stats.indexBytes << " index bytes\n";
+#endif
   return 0;
 }
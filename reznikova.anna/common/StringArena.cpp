@@ -0,0 +1,152 @@
+#include "StringArena.hpp"
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace
+{
+  const reznikova::StringArena::handle_type emptySlot = std::numeric_limits< reznikova::StringArena::handle_type >::max();
+}
+
+reznikova::StringArena::StringArena():
+  buffer_(),
+  offsets_(1, 0),
+  hashes_(),
+  table_(16, emptySlot),
+  lookups_(0),
+  data_(buffer_.data()),
+  offsetData_(offsets_.data()),
+  count_(0),
+  isReadOnly_(false)
+{}
+
+uint32_t reznikova::StringArena::hash(const char * data, size_t length) noexcept
+{
+  uint32_t result = 2166136261u;
+  for (size_t i = 0; i < length; ++i)
+  {
+    result ^= static_cast< unsigned char >(data[i]);
+    result *= 16777619u;
+  }
+  return result;
+}
+
+bool reznikova::StringArena::isEqual(handle_type handle, const char * data, size_t length) const noexcept
+{
+  return getLength(handle) == length and std::memcmp(getData(handle), data, length) == 0;
+}
+
+void reznikova::StringArena::rehash(size_t capacity)
+{
+  std::vector< handle_type > table(capacity, emptySlot);
+  size_t mask = capacity - 1;
+  for (handle_type handle = 0; handle < hashes_.size(); ++handle)
+  {
+    size_t slot = hashes_[handle] & mask;
+    while (table[slot] != emptySlot)
+    {
+      slot = (slot + 1) & mask;
+    }
+    table[slot] = handle;
+  }
+  table_.swap(table);
+}
+
+reznikova::StringArena::handle_type reznikova::StringArena::intern(const char * data, size_t length)
+{
+  if (isReadOnly_)
+  {
+    throw std::logic_error("String arena is read-only");
+  }
+  ++lookups_;
+  uint32_t hashValue = hash(data, length);
+  size_t mask = table_.size() - 1;
+  size_t slot = hashValue & mask;
+  while (table_[slot] != emptySlot)
+  {
+    handle_type handle = table_[slot];
+    if (hashes_[handle] == hashValue and isEqual(handle, data, length))
+    {
+      return handle;
+    }
+    slot = (slot + 1) & mask;
+  }
+  const size_t limit = std::numeric_limits< uint32_t >::max();
+  if (getCount() + 1 >= limit or buffer_.size() + length >= limit)
+  {
+    throw std::length_error("String arena is full");
+  }
+  handle_type handle = static_cast< handle_type >(getCount());
+  buffer_.insert(buffer_.end(), data, data + length);
+  offsets_.push_back(static_cast< uint32_t >(buffer_.size()));
+  hashes_.push_back(hashValue);
+  data_ = buffer_.data();
+  offsetData_ = offsets_.data();
+  count_ = hashes_.size();
+  table_[slot] = handle;
+  if (2 * hashes_.size() > table_.size())
+  {
+    rehash(2 * table_.size());
+  }
+  return handle;
+}
+
+reznikova::StringArena::handle_type reznikova::StringArena::intern(const std::string & value)
+{
+  return intern(value.data(), value.length());
+}
+
+void reznikova::StringArena::attach(const char * buffer, const uint32_t * offsets, size_t count) noexcept
+{
+  data_ = buffer;
+  offsetData_ = offsets;
+  count_ = count;
+  isReadOnly_ = true;
+}
+
+const char * reznikova::StringArena::getData(handle_type handle) const noexcept
+{
+  return data_ + offsetData_[handle];
+}
+
+size_t reznikova::StringArena::getLength(handle_type handle) const noexcept
+{
+  return offsetData_[handle + 1] - offsetData_[handle];
+}
+
+std::string reznikova::StringArena::getString(handle_type handle) const
+{
+  return std::string(getData(handle), getLength(handle));
+}
+
+void reznikova::StringArena::write(std::ostream & out, handle_type handle) const
+{
+  out.write(getData(handle), getLength(handle));
+}
+
+size_t reznikova::StringArena::getCount() const noexcept
+{
+  return count_;
+}
+
+size_t reznikova::StringArena::getBufferSize() const noexcept
+{
+  return offsetData_[count_];
+}
+
+const char * reznikova::StringArena::getBuffer() const noexcept
+{
+  return data_;
+}
+
+const uint32_t * reznikova::StringArena::getOffsets() const noexcept
+{
+  return offsetData_;
+}
+
+reznikova::ArenaStats reznikova::StringArena::getStats() const noexcept
+{
+  size_t indexBytes = (offsets_.capacity() + hashes_.capacity()) * sizeof(uint32_t) + table_.capacity() * sizeof(handle_type);
+  return ArenaStats{getCount(), lookups_, buffer_.capacity(), indexBytes};
+}
@@ -0,0 +1,60 @@
+#ifndef STRINGARENA_HPP
+#define STRINGARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace reznikova
+{
+  struct ArenaStats
+  {
+    size_t strings;
+    size_t lookups;
+    size_t bufferBytes;
+    size_t indexBytes;
+  };
+
+  class StringArena
+  {
+  public:
+    using handle_type = uint32_t;
+
+    StringArena();
+    StringArena(const StringArena &) = delete;
+    StringArena & operator=(const StringArena &) = delete;
+
+    handle_type intern(const char * data, size_t length);
+    handle_type intern(const std::string & value);
+    void attach(const char * buffer, const uint32_t * offsets, size_t count) noexcept;
+    const char * getData(handle_type handle) const noexcept;
+    size_t getLength(handle_type handle) const noexcept;
+    std::string getString(handle_type handle) const;
+    void write(std::ostream & out, handle_type handle) const;
+
+    size_t getCount() const noexcept;
+    size_t getBufferSize() const noexcept;
+    const char * getBuffer() const noexcept;
+    const uint32_t * getOffsets() const noexcept;
+    ArenaStats getStats() const noexcept;
+
+  private:
+    std::vector< char > buffer_;
+    std::vector< uint32_t > offsets_;
+    std::vector< uint32_t > hashes_;
+    std::vector< handle_type > table_;
+    size_t lookups_;
+    const char * data_;
+    const uint32_t * offsetData_;
+    size_t count_;
+    bool isReadOnly_;
+
+    static uint32_t hash(const char * data, size_t length) noexcept;
+    bool isEqual(handle_type handle, const char * data, size_t length) const noexcept;
+    void rehash(size_t capacity);
+  };
+}
+
+#endif
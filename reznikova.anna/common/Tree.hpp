@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <utility>
 #include <algorithm>
+#include <iterator>
 #include <cassert>
 #include "Stack.hpp"
 #include "Queue.hpp"
@@ -26,6 +27,8 @@ namespace reznikova
     Tree(std::initializer_list< std::pair< const Key, Value > > init);
     Tree(const Tree & otherTree);
     Tree(Tree && otherTree);
+    template< class ForwardIt >
+    static Tree buildFromSorted(ForwardIt first, ForwardIt last);
     ~Tree();
     Tree & operator=(const Tree & otherTree);
     Tree & operator=(Tree && otherTree);
@@ -67,6 +70,8 @@ namespace reznikova
     int getBalance(Node * node);
     Node * balance(Node * node);
     Node * insert(Node * node, const Key & key, const Value & value, Node* parent);
+    template< class ForwardIt >
+    Node * buildSubtree(ForwardIt & first, size_t count, Node * parent);
     Node * erase(Node * node, const Key & key);
     Node * find(Node * node, const Key & key) const;
     Node* lowerBoundNode(Node * node, const Key & key) const;
@@ -393,10 +398,9 @@ Tree< Key, Value, Comparator >::Tree(const Tree & otherTree):
   cmp_(otherTree.cmp_),
   size_(0)
 {
-  for (ConstIterator it = otherTree.cbegin(); it != otherTree.cend(); ++it)
-  {
-    insert(it->first, it->second);
-  }
+  ConstIterator it = otherTree.cbegin();
+  root_ = buildSubtree(it, otherTree.size_, nullptr);
+  size_ = otherTree.size_;
 }
 
 template< typename Key, typename Value, typename Comparator >
@@ -409,6 +413,52 @@ Tree< Key, Value, Comparator >::Tree(Tree && otherTree) :
   otherTree.size_ = 0;
 }
 
+template< typename Key, typename Value, typename Comparator >
+template< class ForwardIt >
+Tree< Key, Value, Comparator > Tree< Key, Value, Comparator >::buildFromSorted(ForwardIt first, ForwardIt last)
+{
+  Tree< Key, Value, Comparator > tree;
+  size_t count = std::distance(first, last);
+  tree.root_ = tree.buildSubtree(first, count, nullptr);
+  tree.size_ = count;
+  return tree;
+}
+
+template< typename Key, typename Value, typename Comparator >
+template< class ForwardIt >
+typename Tree< Key, Value, Comparator >::Node * Tree< Key, Value, Comparator >::buildSubtree(ForwardIt & first,
+  size_t count, Node * parent)
+{
+  if (count == 0)
+  {
+    return nullptr;
+  }
+  Node * left = buildSubtree(first, count / 2, nullptr);
+  Node * node = nullptr;
+  Node * right = nullptr;
+  try
+  {
+    node = new Node(first->first, first->second);
+    ++first;
+    right = buildSubtree(first, count - count / 2 - 1, node);
+  }
+  catch (...)
+  {
+    clear(left);
+    delete node;
+    throw;
+  }
+  node->parent_ = parent;
+  node->left_ = left;
+  node->right_ = right;
+  if (left)
+  {
+    left->parent_ = node;
+  }
+  updateHeight(node);
+  return node;
+}
+
 template< typename Key, typename Value, typename Comparator >
 template< class InputIt >
 Tree< Key, Value, Comparator >::Tree(InputIt first, InputIt last):
@@ -0,0 +1,116 @@
+#ifndef RINGBUFFER_HPP
+#define RINGBUFFER_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace sobolevsky
+{
+  template< typename T >
+  class RingBuffer
+  {
+  public:
+    RingBuffer();
+
+    void reserve(size_t capacity);
+    void push(const T& data);
+    T front() const;
+    void pop();
+    void clear() noexcept;
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+  private:
+    std::vector< T > data_;
+    size_t head_;
+    size_t size_;
+  };
+}
+
+template< typename T >
+sobolevsky::RingBuffer< T >::RingBuffer():
+  data_(),
+  head_(0),
+  size_(0)
+{}
+
+template< typename T >
+void sobolevsky::RingBuffer< T >::reserve(size_t capacity)
+{
+  if (capacity <= data_.size())
+  {
+    return;
+  }
+  size_t newCapacity = 1;
+  while (newCapacity < capacity)
+  {
+    newCapacity *= 2;
+  }
+  std::vector< T > newData(newCapacity);
+  for (size_t i = 0; i < size_; i++)
+  {
+    newData[i] = data_[(head_ + i) & (data_.size() - 1)];
+  }
+  data_.swap(newData);
+  head_ = 0;
+}
+
+template< typename T >
+void sobolevsky::RingBuffer< T >::push(const T& data)
+{
+  if (size_ == data_.size())
+  {
+    reserve(size_ + 1);
+  }
+  data_[(head_ + size_) & (data_.size() - 1)] = data;
+  size_++;
+}
+
+template< typename T >
+T sobolevsky::RingBuffer< T >::front() const
+{
+  if (size_ == 0)
+  {
+    throw std::logic_error("buffer is empty");
+  }
+  return data_[head_];
+}
+
+template< typename T >
+void sobolevsky::RingBuffer< T >::pop()
+{
+  if (size_ == 0)
+  {
+    throw std::logic_error("buffer is empty");
+  }
+  head_ = (head_ + 1) & (data_.size() - 1);
+  size_--;
+}
+
+template< typename T >
+void sobolevsky::RingBuffer< T >::clear() noexcept
+{
+  head_ = 0;
+  size_ = 0;
+}
+
+template< typename T >
+bool sobolevsky::RingBuffer< T >::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< typename T >
+size_t sobolevsky::RingBuffer< T >::size() const noexcept
+{
+  return size_;
+}
+
+template< typename T >
+size_t sobolevsky::RingBuffer< T >::capacity() const noexcept
+{
+  return data_.size();
+}
+
+#endif
@@ -8,6 +8,7 @@
 #include <iterator>
 #include <queue.hpp>
 #include <stack.hpp>
+#include <ringBuffer.hpp>
 
 namespace sobolevsky
 {
@@ -60,9 +61,26 @@ namespace sobolevsky
     F traverse_rnl(F f);
     template< typename F >
     F traverse_breadth(F f);
+    template< typename F >
+    F traverse_lnr_parent(F f) const;
+    template< typename F >
+    F traverse_rnl_parent(F f) const;
+    template< typename F >
+    F traverse_lnr_parent(F f);
+    template< typename F >
+    F traverse_rnl_parent(F f);
+    template< typename F >
+    F traverse_breadth_buffered(F f) const;
+    template< typename F >
+    F traverse_breadth_buffered(F f);
   private:
     class Node;
 
+    template< typename Data, typename F >
+    static F parentTraverse(Node *node_, F f, Node *Node::*first, Node *Node::*second);
+    template< typename Data, typename F >
+    F bufferedTraverse(F f, RingBuffer< Node* > &frontier) const;
+
     Node *push(const Key &key, const Value &value, Node *node_);
     Node *RightRotate(Node *node_);
     Node *LeftRotate(Node *node_);
@@ -74,6 +92,7 @@ namespace sobolevsky
 
     Node *root;
     size_t size_;
+    RingBuffer< Node* > frontier_;
   };
 }
 
@@ -174,10 +193,10 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree<
   {
     node_->left = push(key, value, node_->left);
     node_->left->parent = node_;
-    node_->height++;
-    if (height(node_->left) - height(node_->right) > 1)
+    node_->height = std::max(height(node_->left), height(node_->right)) + 1;
+    if (height(node_->left) > height(node_->right) + 1)
     {
-      if (node_->right == nullptr || key < node_->left->data.first)
+      if (key < node_->left->data.first)
       {
         node_ = RightRotate(node_);
       }
@@ -191,10 +210,10 @@ typename sobolevsky::AVLtree< Key, Value, Compare >::Node *sobolevsky::AVLtree<
   {
     node_->right = push(key, value, node_->right);
     node_->right->parent = node_;
-    node_->height++;
-    if ((height(node_->right) - height(node_->left)) > 1)
+    node_->height = std::max(height(node_->left), height(node_->right)) + 1;
+    if (height(node_->right) > height(node_->left) + 1)
     {
-      if (node_->left == nullptr || key > node_->right->data.first)
+      if (key > node_->right->data.first)
       {
         node_ = LeftRotate(node_);
       }
@@ -1020,6 +1039,112 @@ F sobolevsky::AVLtree< Key, Value, Compare >::traverse_breadth(F f)
   return f;
 }
 
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::traverse_lnr_parent(F f) const
+{
+  return parentTraverse< const std::pair< Key, Value > >(root, f, &Node::left, &Node::right);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::traverse_rnl_parent(F f) const
+{
+  return parentTraverse< const std::pair< Key, Value > >(root, f, &Node::right, &Node::left);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::traverse_lnr_parent(F f)
+{
+  return parentTraverse< std::pair< Key, Value > >(root, f, &Node::left, &Node::right);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::traverse_rnl_parent(F f)
+{
+  return parentTraverse< std::pair< Key, Value > >(root, f, &Node::right, &Node::left);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename Data, typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::parentTraverse(Node *node_, F f, Node *Node::*first, Node *Node::*second)
+{
+  if (node_ == nullptr)
+  {
+    return f;
+  }
+  while (node_->*first != nullptr)
+  {
+    node_ = node_->*first;
+  }
+  while (node_ != nullptr)
+  {
+    f(static_cast< Data & >(node_->data));
+    if (node_->*second != nullptr)
+    {
+      node_ = node_->*second;
+      while (node_->*first != nullptr)
+      {
+        node_ = node_->*first;
+      }
+    }
+    else
+    {
+      while (node_->parent != nullptr && node_ == node_->parent->*second)
+      {
+        node_ = node_->parent;
+      }
+      node_ = node_->parent;
+    }
+  }
+  return f;
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::traverse_breadth_buffered(F f) const
+{
+  RingBuffer< Node* > frontier;
+  return bufferedTraverse< const std::pair< Key, Value > >(f, frontier);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::traverse_breadth_buffered(F f)
+{
+  return bufferedTraverse< std::pair< Key, Value > >(f, frontier_);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename Data, typename F >
+F sobolevsky::AVLtree< Key, Value, Compare >::bufferedTraverse(F f, RingBuffer< Node* > &frontier) const
+{
+  frontier.clear();
+  if (root == nullptr)
+  {
+    return f;
+  }
+  frontier.reserve(size_ / 2 + 1);
+  frontier.push(root);
+  while (!(frontier.empty()))
+  {
+    Node *temp = frontier.front();
+    frontier.pop();
+    if (temp->left != nullptr)
+    {
+      frontier.push(temp->left);
+    }
+    if (temp->right != nullptr)
+    {
+      frontier.push(temp->right);
+    }
+    f(static_cast< Data & >(temp->data));
+  }
+  return f;
+}
+
 template< typename Key, typename Value, typename Compare >
 class sobolevsky::AVLtree< Key, Value, Compare >::LNRIterator : public std::iterator< std::input_iterator_tag, Key, Value, Compare >
 {
@@ -14,7 +14,8 @@ namespace zheleznyakov
     long long getKeySum();
     std::string getValueSum();
   private:
-    long long keySum_;
+    __int128 keySum_;
+    bool isOverflowed_;
     std::string valueSum_;
   };
 }
@@ -0,0 +1,123 @@
+#include <cctype>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <Queue.hpp>
+#include "ExpressionCache.hpp"
+#include "ExpressionEvaluator.hpp"
+
+constexpr char zhitnyj::ExpressionCache::PUSH;
+
+zhitnyj::ExpressionCache::ExpressionCache(size_t capacity) :
+  slots(new Slot[capacity == 0 ? 1 : capacity]),
+  capacity(capacity == 0 ? 1 : capacity),
+  hits(0),
+  misses(0)
+{}
+
+long long zhitnyj::ExpressionCache::evaluate(const std::string& ep)
+{
+  std::string key = normalize(ep);
+  Slot& slot = slots[std::hash< std::string >()(key) % capacity];
+  if (slot.isUsed && slot.key == key)
+  {
+    ++hits;
+    return run(slot.code);
+  }
+  ++misses;
+  Bytecode code = compile(key);
+  slot.isUsed = true;
+  slot.key = std::move(key);
+  slot.code = std::move(code);
+  return run(slot.code);
+}
+
+size_t zhitnyj::ExpressionCache::getHits() const noexcept
+{
+  return hits;
+}
+
+size_t zhitnyj::ExpressionCache::getMisses() const noexcept
+{
+  return misses;
+}
+
+std::string zhitnyj::ExpressionCache::normalize(const std::string& ep)
+{
+  std::string normalized;
+  normalized.reserve(ep.length());
+  bool isSpace = false;
+  for (size_t i = 0; i < ep.length(); ++i)
+  {
+    if (std::isspace(ep[i]))
+    {
+      isSpace = true;
+    }
+    else
+    {
+      if (isSpace && !normalized.empty())
+      {
+        normalized.push_back(' ');
+      }
+      isSpace = false;
+      normalized.push_back(ep[i]);
+    }
+  }
+  return normalized;
+}
+
+zhitnyj::Bytecode zhitnyj::ExpressionCache::compile(const std::string& ep)
+{
+  Queue< ExpressionItem > expressionQueue;
+  ExpressionEvaluator::parseExpression(expressionQueue, ep);
+  Queue< ExpressionItem > postfixQueue = ExpressionEvaluator::toPostfix(expressionQueue);
+
+  Bytecode code;
+  code.reserve(postfixQueue.size());
+  while (!postfixQueue.empty())
+  {
+    ExpressionItem item = postfixQueue.front();
+    postfixQueue.pop();
+    if (item.isOperand())
+    {
+      code.push_back({ PUSH, item.getOperand().getValue() });
+    }
+    else
+    {
+      code.push_back({ item.getOperator().getOperator(), 0 });
+    }
+  }
+  return code;
+}
+
+long long zhitnyj::ExpressionCache::run(const Bytecode& code)
+{
+  std::vector< long long > evaluationStack;
+  evaluationStack.reserve(code.size());
+
+  for (const Instruction& instruction : code)
+  {
+    if (instruction.opcode == PUSH)
+    {
+      evaluationStack.push_back(instruction.value);
+      continue;
+    }
+    if (evaluationStack.size() < 2)
+    {
+      throw std::runtime_error("Insufficient values in the ep for operation");
+    }
+    long long right = evaluationStack.back();
+    evaluationStack.pop_back();
+    long long left = evaluationStack.back();
+    evaluationStack.pop_back();
+    Operator op(instruction.opcode);
+    evaluationStack.push_back(ExpressionEvaluator::applyOperator(op, left, right));
+  }
+
+  if (evaluationStack.size() != 1)
+  {
+    throw std::runtime_error("The expression does not reduce to a single value");
+  }
+
+  return evaluationStack.back();
+}
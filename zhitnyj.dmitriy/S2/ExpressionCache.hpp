@@ -0,0 +1,48 @@
+#ifndef EXPRESSION_CACHE_HPP
+#define EXPRESSION_CACHE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace zhitnyj {
+  struct Instruction
+  {
+    char opcode;
+    long long value;
+  };
+
+  using Bytecode = std::vector< Instruction >;
+
+  class ExpressionCache
+  {
+  public:
+    static constexpr char PUSH = '\0';
+
+    explicit ExpressionCache(size_t capacity = 4096);
+    ~ExpressionCache() = default;
+
+    long long evaluate(const std::string& ep);
+    size_t getHits() const noexcept;
+    size_t getMisses() const noexcept;
+
+    static std::string normalize(const std::string& ep);
+    static Bytecode compile(const std::string& ep);
+    static long long run(const Bytecode& code);
+
+  private:
+    struct Slot
+    {
+      std::string key;
+      Bytecode code;
+      bool isUsed = false;
+    };
+
+    std::unique_ptr< Slot[] > slots;
+    size_t capacity;
+    size_t hits;
+    size_t misses;
+  };
+}
+
+#endif
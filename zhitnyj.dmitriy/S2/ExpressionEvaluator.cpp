@@ -1,12 +1,15 @@
 #include <limits>
 #include <stdexcept>
-#include <memory>
 #include <cmath>
 #include <string>
 #include <cctype>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "ExpressionEvaluator.hpp"
 
-void zhitnyj::ExpressionEvaluator::parseExpression(zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > >& qe, const std::string& ep)
+void zhitnyj::ExpressionEvaluator::parseExpression(zhitnyj::Queue< zhitnyj::ExpressionItem >& qe, const std::string& ep)
 {
   std::string token;
   for (size_t i = 0; i < ep.length(); ++i)
@@ -18,11 +21,11 @@ void zhitnyj::ExpressionEvaluator::parseExpression(zhitnyj::Queue< std::shared_p
       {
         if (std::isdigit(token[0]) || (token[0] == '-' && token.size() > 1 && std::isdigit(token[1])))
         {
-          qe.push(std::make_shared< Operand >(std::stoll(token)));
+          qe.push(ExpressionItem(Operand(std::stoll(token))));
         }
         else if (token.size() == 1 && Operator::isOperator(token[0]))
         {
-          qe.push(std::make_shared< Operator >(token[0]));
+          qe.push(ExpressionItem(Operator(token[0])));
         }
         else
         {
@@ -41,11 +44,11 @@ void zhitnyj::ExpressionEvaluator::parseExpression(zhitnyj::Queue< std::shared_p
   {
     if (std::isdigit(token[0]) || (token[0] == '-' && token.size() > 1 && std::isdigit(token[1])))
     {
-      qe.push(std::make_shared< Operand >(std::stoll(token)));
+      qe.push(ExpressionItem(Operand(std::stoll(token))));
     }
     else if (token.size() == 1 && Operator::isOperator(token[0]))
     {
-      qe.push(std::make_shared< Operator >(token[0]));
+      qe.push(ExpressionItem(Operator(token[0])));
     }
     else
     {
@@ -54,32 +57,32 @@ void zhitnyj::ExpressionEvaluator::parseExpression(zhitnyj::Queue< std::shared_p
   }
 }
 
-zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > >
-zhitnyj::ExpressionEvaluator::toPostfix(zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > >& inQe)
+zhitnyj::Queue< zhitnyj::ExpressionItem >
+zhitnyj::ExpressionEvaluator::toPostfix(zhitnyj::Queue< zhitnyj::ExpressionItem >& inQe)
 {
-  Stack< std::shared_ptr< ExpressionItem > > operatorStack;
-  Queue< std::shared_ptr< ExpressionItem > > postfixQueue;
+  Stack< ExpressionItem > operatorStack;
+  Queue< ExpressionItem > postfixQueue;
 
   while (!inQe.empty())
   {
-    std::shared_ptr< ExpressionItem > item = inQe.front();
+    ExpressionItem item = inQe.front();
     inQe.pop();
 
-    if (item->isOperand())
+    if (item.isOperand())
     {
       postfixQueue.push(item);
     }
-    else if (item->isOperator())
+    else if (item.isOperator())
     {
-      auto operator_ = std::dynamic_pointer_cast< Operator >(item);
+      const Operator& operator_ = item.getOperator();
 
-      if (operator_->isLeftParenthesis())
+      if (operator_.isLeftParenthesis())
       {
-        operatorStack.push(operator_);
+        operatorStack.push(item);
       }
-      else if (operator_->isRightParenthesis())
+      else if (operator_.isRightParenthesis())
       {
-        while (!operatorStack.empty() && !std::dynamic_pointer_cast< Operator >(operatorStack.top())->isLeftParenthesis())
+        while (!operatorStack.empty() && !operatorStack.top().getOperator().isLeftParenthesis())
         {
           postfixQueue.push(operatorStack.top());
           operatorStack.pop();
@@ -89,13 +92,13 @@ zhitnyj::ExpressionEvaluator::toPostfix(zhitnyj::Queue< std::shared_ptr< zhitnyj
       else
       {
         while (!operatorStack.empty()
-            && std::dynamic_pointer_cast< Operator >(operatorStack.top())->precedence() >= operator_->precedence()
-            && !std::dynamic_pointer_cast< Operator >(operatorStack.top())->isLeftParenthesis())
+            && operatorStack.top().getOperator().precedence() >= operator_.precedence()
+            && !operatorStack.top().getOperator().isLeftParenthesis())
         {
           postfixQueue.push(operatorStack.top());
           operatorStack.pop();
         }
-        operatorStack.push(operator_);
+        operatorStack.push(item);
       }
     }
   }
@@ -109,25 +112,41 @@ zhitnyj::ExpressionEvaluator::toPostfix(zhitnyj::Queue< std::shared_ptr< zhitnyj
   return postfixQueue;
 }
 
-long long zhitnyj::ExpressionEvaluator::evaluateExpression(zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > >& postfixQueue)
+long long zhitnyj::ExpressionEvaluator::applyOperator(const Operator& op, long long left, long long right)
+{
+  bool add_overflow = op.getOperator() == '+' && (left > (std::numeric_limits< long long >::max() - right));
+  bool multiply_overflow = op.getOperator() == '*' && right != 0
+      && (std::abs(left) > (std::numeric_limits< long long >::max() / right));
+  bool minus_overflow = op.getOperator() == '-' && (left < (std::numeric_limits< long long >::min() + right));
+  bool divide_overflow = (op.getOperator() == '/' || op.getOperator() == '%')
+      && ((left == std::numeric_limits< long long >::min()) && right == -1);
+
+  if (add_overflow || multiply_overflow)
+  {
+    throw std::overflow_error("There was an overflow error!");
+  }
+  else if (minus_overflow || divide_overflow)
+  {
+    throw std::overflow_error("There was an underflow error!");
+  }
+  return op.applyOp(left, right);
+}
+
+long long zhitnyj::ExpressionEvaluator::evaluateExpression(zhitnyj::Queue< zhitnyj::ExpressionItem >& postfixQueue)
 {
   Stack< long long > evaluationStack;
 
   while (!postfixQueue.empty())
   {
-    std::shared_ptr< ExpressionItem > item = postfixQueue.front();
+    ExpressionItem item = postfixQueue.front();
     postfixQueue.pop();
 
-    if (item->isOperand())
+    if (item.isOperand())
     {
-      auto operand = std::dynamic_pointer_cast< Operand >(item);
-
-      evaluationStack.push(operand->getValue());
+      evaluationStack.push(item.getOperand().getValue());
     }
-    else if (item->isOperator())
+    else if (item.isOperator())
     {
-      auto op = std::dynamic_pointer_cast< Operator >(item);
-
       if (evaluationStack.size() < 2)
       {
         throw std::runtime_error("Insufficient values in the ep for operation");
@@ -136,21 +155,7 @@ long long zhitnyj::ExpressionEvaluator::evaluateExpression(zhitnyj::Queue< std::
       evaluationStack.pop();
       long long left = evaluationStack.top();
       evaluationStack.pop();
-      bool add_overflow = op->getOperator() == '+' && (left > (std::numeric_limits< long long >::max() - right));
-      bool multiply_overflow = op->getOperator() == '*' && (std::abs(left) > (std::numeric_limits< long long >::max() / right));
-      bool minus_overflow = op->getOperator() == '-' && (left < (std::numeric_limits< long long >::min() + right));
-      bool divide_overflow = op->getOperator() == '/' && ((left == std::numeric_limits< long long >::min()) && right == -1);
-
-      if (add_overflow || multiply_overflow)
-      {
-        throw std::overflow_error("There was an overflow error!");
-      }
-      else if (minus_overflow || divide_overflow)
-      {
-        throw std::overflow_error("There was an underflow error!");
-      }
-      long long result = op->applyOp(left, right);
-      evaluationStack.push(result);
+      evaluationStack.push(applyOperator(item.getOperator(), left, right));
     }
     else
     {
@@ -165,3 +170,92 @@ long long zhitnyj::ExpressionEvaluator::evaluateExpression(zhitnyj::Queue< std::
 
   return evaluationStack.top();
 }
+
+long long zhitnyj::ExpressionEvaluator::evaluateLine(const std::string& line)
+{
+  Queue< ExpressionItem > expressionQueue;
+  parseExpression(expressionQueue, line);
+  Queue< ExpressionItem > postfixQueue = toPostfix(expressionQueue);
+  return evaluateExpression(postfixQueue);
+}
+
+namespace {
+  struct Batch
+  {
+    zhitnyj::List< long long > values;
+    std::exception_ptr error;
+  };
+}
+
+void zhitnyj::ExpressionEvaluator::evaluateLines(std::istream& in, Stack< long long >& results, size_t workers)
+{
+  const size_t batchSize = 256;
+  List< std::shared_ptr< Batch > > batches;
+  std::mutex inputMutex;
+  bool isFailed = false;
+
+  auto evaluateBatches = [&]()
+  {
+    std::string line;
+    while (true)
+    {
+      List< std::string > lines;
+      size_t count = 0;
+      std::shared_ptr< Batch > batch = std::make_shared< Batch >();
+      {
+        std::lock_guard< std::mutex > lock(inputMutex);
+        while (!isFailed && count < batchSize && std::getline(in, line))
+        {
+          if (!line.empty())
+          {
+            lines.push_front(line);
+            ++count;
+          }
+        }
+        if (count == 0)
+        {
+          return;
+        }
+        batches.push_front(batch);
+      }
+      lines.reverse();
+      try
+      {
+        for (const std::string& expression : lines)
+        {
+          batch->values.push_front(evaluateLine(expression));
+        }
+      }
+      catch (...)
+      {
+        batch->error = std::current_exception();
+        std::lock_guard< std::mutex > lock(inputMutex);
+        isFailed = true;
+      }
+      batch->values.reverse();
+    }
+  };
+
+  List< std::shared_ptr< std::thread > > pool;
+  for (size_t i = 0; i < workers; ++i)
+  {
+    pool.push_front(std::make_shared< std::thread >(evaluateBatches));
+  }
+  for (const std::shared_ptr< std::thread >& worker : pool)
+  {
+    worker->join();
+  }
+
+  batches.reverse();
+  for (const std::shared_ptr< Batch >& batch : batches)
+  {
+    for (long long value : batch->values)
+    {
+      results.push(value);
+    }
+    if (batch->error)
+    {
+      std::rethrow_exception(batch->error);
+    }
+  }
+}
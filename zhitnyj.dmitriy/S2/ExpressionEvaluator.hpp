@@ -1,6 +1,7 @@
 #ifndef EXPRESSION_EVALUATOR_HPP
 #define EXPRESSION_EVALUATOR_HPP
 
+#include <istream>
 #include <string>
 #include <Queue.hpp>
 #include <Stack.hpp>
@@ -15,9 +16,12 @@ namespace zhitnyj {
     ExpressionEvaluator() = default;
     ~ExpressionEvaluator() = default;
 
-    static void parseExpression(Queue< std::shared_ptr< ExpressionItem > >& qe, const std::string& ep);
-    static Queue< std::shared_ptr< ExpressionItem > > toPostfix(Queue< std::shared_ptr< ExpressionItem > >& inQe);
-    static long long evaluateExpression(Queue< std::shared_ptr< ExpressionItem > >& postfixQueue);
+    static void parseExpression(Queue< ExpressionItem >& qe, const std::string& ep);
+    static Queue< ExpressionItem > toPostfix(Queue< ExpressionItem >& inQe);
+    static long long applyOperator(const Operator& op, long long left, long long right);
+    static long long evaluateExpression(Queue< ExpressionItem >& postfixQueue);
+    static long long evaluateLine(const std::string& line);
+    static void evaluateLines(std::istream& in, Stack< long long >& results, size_t workers);
   };
 }
 
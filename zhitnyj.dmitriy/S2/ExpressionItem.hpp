@@ -1,15 +1,67 @@
 #ifndef EXPRESSION_ITEM_HPP
 #define EXPRESSION_ITEM_HPP
 
+#include "Operand.hpp"
+#include "Operator.hpp"
+
 namespace zhitnyj {
   class ExpressionItem
   {
   public:
-    virtual ~ExpressionItem() = default;
+    explicit ExpressionItem(const Operand& operand);
+    explicit ExpressionItem(const Operator& op);
+    ~ExpressionItem() = default;
+
+    bool isOperator() const noexcept;
+    bool isOperand() const noexcept;
+
+    const Operand& getOperand() const noexcept;
+    const Operator& getOperator() const noexcept;
+
+  private:
+    enum class Kind : char
+    {
+      OPERAND,
+      OPERATOR
+    };
 
-    virtual bool isOperator() = 0;
-    virtual bool isOperand() = 0;
+    Kind kind;
+    union
+    {
+      Operand operand;
+      Operator operator_;
+    };
   };
+
+  inline ExpressionItem::ExpressionItem(const Operand& operand) :
+    kind(Kind::OPERAND),
+    operand(operand)
+  {}
+
+  inline ExpressionItem::ExpressionItem(const Operator& op) :
+    kind(Kind::OPERATOR),
+    operator_(op)
+  {}
+
+  inline bool ExpressionItem::isOperator() const noexcept
+  {
+    return kind == Kind::OPERATOR;
+  }
+
+  inline bool ExpressionItem::isOperand() const noexcept
+  {
+    return kind == Kind::OPERAND;
+  }
+
+  inline const Operand& ExpressionItem::getOperand() const noexcept
+  {
+    return operand;
+  }
+
+  inline const Operator& ExpressionItem::getOperator() const noexcept
+  {
+    return operator_;
+  }
 }
 
 #endif
@@ -3,17 +3,7 @@
 zhitnyj::Operand::Operand(long long val) : value(val)
 {}
 
-long long zhitnyj::Operand::getValue()
+long long zhitnyj::Operand::getValue() const
 {
   return value;
 }
-
-bool zhitnyj::Operand::isOperator()
-{
-  return false;
-}
-
-bool zhitnyj::Operand::isOperand()
-{
-  return true;
-}
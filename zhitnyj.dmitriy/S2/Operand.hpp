@@ -1,18 +1,14 @@
 #ifndef OPERAND_HPP
 #define OPERAND_HPP
 
-#include "ExpressionItem.hpp"
-
 namespace zhitnyj {
-  class Operand : public ExpressionItem
+  class Operand
   {
   public:
     explicit Operand(long long val);
     ~Operand() = default;
 
-    long long getValue();
-    bool isOperator() override;
-    bool isOperand() override;
+    long long getValue() const;
 
   private:
     long long value;
@@ -45,28 +45,21 @@ int zhitnyj::Operator::precedence() const
 
 long long zhitnyj::Operator::applyOp(long long a, long long b) const
 {
-  if (operator_ == '+')
+  switch (operator_)
   {
+  case '+':
     return a + b;
-  }
-  else if (operator_ == '-')
-  {
+  case '-':
     return a - b;
-  }
-  else if (operator_ == '*')
-  {
+  case '*':
     return a * b;
-  }
-  else if (operator_ == '/')
-  {
+  case '/':
     if (b == 0)
     {
       throw std::runtime_error("Division by zero");
     }
     return a / b;
-  }
-  else if (operator_ == '%')
-  {
+  case '%':
     if (b == 0)
     {
       throw std::runtime_error("Modulo by zero");
@@ -76,23 +69,11 @@ long long zhitnyj::Operator::applyOp(long long a, long long b) const
       return a % b + abs(b);
     }
     return a % b;
-  }
-  else
-  {
+  default:
     throw std::invalid_argument("Invalid operation");
   }
 }
 
-bool zhitnyj::Operator::isOperator()
-{
-  return true;
-}
-
-bool zhitnyj::Operator::isOperand()
-{
-  return false;
-}
-
 bool zhitnyj::Operator::isOperator(char c)
 {
   return c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '(' || c == ')';
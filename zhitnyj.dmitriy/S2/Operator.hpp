@@ -2,10 +2,9 @@
 #define OPERATOR_HPP
 
 #include <stdexcept>
-#include "ExpressionItem.hpp"
 
 namespace zhitnyj {
-  class Operator : public ExpressionItem
+  class Operator
   {
   public:
     explicit Operator(char op);
@@ -18,9 +17,6 @@ namespace zhitnyj {
     long long applyOp(long long a, long long b) const;
     static bool isOperator(char c);
 
-    bool isOperator() override;
-    bool isOperand() override;
-
   private:
     char operator_;
   };
@@ -1,19 +1,65 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <Queue.hpp>
 #include <Stack.hpp>
+#ifdef ZHITNYJ_CACHE_STATS
+#include <chrono>
+#endif
 #include "ExpressionItem.hpp"
 #include "ExpressionEvaluator.hpp"
+#include "ExpressionCache.hpp"
+
+namespace
+{
+#ifdef ZHITNYJ_PARALLEL_EVALUATION
+  size_t getWorkers()
+  {
+    size_t workers = std::thread::hardware_concurrency();
+    return workers == 0 ? 1 : workers;
+  }
+#endif
+
+  void evaluateLines(std::istream& in, zhitnyj::Stack< long long >& results)
+  {
+#ifdef ZHITNYJ_PARALLEL_EVALUATION
+    zhitnyj::ExpressionEvaluator::evaluateLines(in, results, getWorkers());
+#else
+    zhitnyj::ExpressionCache cache;
+#ifdef ZHITNYJ_CACHE_STATS
+    auto start = std::chrono::steady_clock::now();
+#endif
+    std::string line;
+    while (std::getline(in, line))
+    {
+      if (!line.empty())
+      {
+#ifdef ZHITNYJ_NO_EXPRESSION_CACHE
+        results.push(zhitnyj::ExpressionEvaluator::evaluateLine(line));
+#else
+        results.push(cache.evaluate(line));
+#endif
+      }
+    }
+#ifdef ZHITNYJ_CACHE_STATS
+    auto elapsed = std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start);
+    size_t lines = results.size();
+    size_t lookups = cache.getHits() + cache.getMisses();
+    std::cerr << "lines: " << lines;
+    std::cerr << ", cache hits: " << cache.getHits() << "/" << lookups;
+    std::cerr << ", ns per line: " << (lines == 0 ? 0 : elapsed.count() / lines) << "\n";
+#endif
+#endif
+  }
+}
 
 int main(int argc, char* argv[])
 {
-  zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > > expressionQueue;
   zhitnyj::Stack< long long > results;
 
   try
   {
-    std::string line;
     if (argc > 1)
     {
       std::ifstream file(argv[1]);
@@ -22,34 +68,18 @@ int main(int argc, char* argv[])
         std::cerr << "Cannot open file: " << argv[1] << "\n";
         return 1;
       }
-      while (std::getline(file, line))
-      {
-        if (!line.empty())
-        {
-          zhitnyj::ExpressionEvaluator::parseExpression(expressionQueue, line);
-          zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > > postfixQueue = zhitnyj::ExpressionEvaluator::toPostfix(expressionQueue);
-          results.push(zhitnyj::ExpressionEvaluator::evaluateExpression(postfixQueue));
-          expressionQueue.clear();
-        }
-      }
+      evaluateLines(file, results);
     }
     else
     {
-      while (std::getline(std::cin, line))
-      {
-        if (!line.empty())
-        {
-          zhitnyj::ExpressionEvaluator::parseExpression(expressionQueue, line);
-          zhitnyj::Queue< std::shared_ptr< zhitnyj::ExpressionItem > > postfixQueue = zhitnyj::ExpressionEvaluator::toPostfix(expressionQueue);
-          results.push(zhitnyj::ExpressionEvaluator::evaluateExpression(postfixQueue));
-          expressionQueue.clear();
-        }
-      }
+      evaluateLines(std::cin, results);
     }
 
+    bool isFirst = true;
     while (!results.empty())
     {
-      std::cout << results.top() << (results.size() == 1 ? "" : " ");
+      std::cout << (isFirst ? "" : " ") << results.top();
+      isFirst = false;
       results.pop();
     }
     std::cout << "\n";